@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+// bench.hpp header file
+//
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_FOREACH_BENCH_BENCH_HPP
+#define BOOST_FOREACH_BENCH_BENCH_HPP
+
+#include <chrono>
+#include <cstdio>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <boost/config.hpp>
+#include <boost/version.hpp>
+#include <boost/foreach.hpp>
+
+// The build passes the optimization level the benchmark was compiled with
+#ifndef BOOST_FOREACH_BENCH_OPTIMIZATION
+# define BOOST_FOREACH_BENCH_OPTIMIZATION unknown
+#endif
+
+#define BOOST_FOREACH_BENCH_STRINGIZE(x) BOOST_FOREACH_BENCH_STRINGIZE_I(x)
+#define BOOST_FOREACH_BENCH_STRINGIZE_I(x) #x
+
+namespace bench
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// do_not_optimize
+//   Keep the optimizer from discarding a result that is otherwise unused.
+template<typename T>
+inline void do_not_optimize(T const &t)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(t) : "memory");
+#else
+    static T volatile sink;
+    sink = t;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// measure
+//   Runs f repeatedly and returns the best observed time per element, in
+//   nanoseconds. f processes elements elements per call.
+template<typename F>
+inline double measure(F f, std::size_t elements, int repetitions = 7)
+{
+    typedef std::chrono::steady_clock clock;
+    // grow the batch until one sample takes at least a few milliseconds
+    std::size_t batch = 1;
+    for(;;)
+    {
+        clock::time_point start = clock::now();
+        for(std::size_t i = 0; i < batch; ++i)
+            f();
+        if(clock::now() - start > std::chrono::milliseconds(5))
+            break;
+        batch *= 2;
+    }
+
+    double best = 0;
+    for(int r = 0; r < repetitions; ++r)
+    {
+        clock::time_point start = clock::now();
+        for(std::size_t i = 0; i < batch; ++i)
+            f();
+        double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+        ns /= static_cast<double>(batch) * static_cast<double>(elements ? elements : 1);
+        if(0 == r || ns < best)
+            best = ns;
+    }
+    return best;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// result
+//
+struct result
+{
+    std::string group;
+    std::string name;
+    double ns_per_element;
+};
+
+inline std::vector<result> &results()
+{
+    static std::vector<result> r;
+    return r;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// report
+//   Prints a measurement and records it for write_json.
+inline void report(std::string const &group, std::string const &name, double ns_per_element)
+{
+    std::printf("%-24s %-40s %10.3f ns/elem\n", group.c_str(), name.c_str(), ns_per_element);
+    result r = {group, name, ns_per_element};
+    results().push_back(r);
+}
+
+inline std::string json_string(std::string const &str)
+{
+    std::string out = "\"";
+    for(std::size_t i = 0; i < str.size(); ++i)
+    {
+        if('"' == str[i] || '\\' == str[i])
+            out += '\\';
+        out += str[i];
+    }
+    return out + "\"";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// write_json
+//   Writes every recorded measurement, along with enough about the build to
+//   compare results from one Boost release to the next.
+inline bool write_json(char const *path, char const *benchmark)
+{
+    std::FILE *file = std::fopen(path, "w");
+    if(!file)
+        return false;
+
+    std::fprintf(file, "{\n");
+    std::fprintf(file, "  \"benchmark\": %s,\n", json_string(benchmark).c_str());
+    std::fprintf(file, "  \"boost_version\": %s,\n", json_string(BOOST_LIB_VERSION).c_str());
+    std::fprintf(file, "  \"compiler\": %s,\n", json_string(BOOST_COMPILER).c_str());
+    std::fprintf(file, "  \"platform\": %s,\n", json_string(BOOST_PLATFORM).c_str());
+    std::fprintf(file, "  \"optimization\": %s,\n",
+        json_string(BOOST_FOREACH_BENCH_STRINGIZE(BOOST_FOREACH_BENCH_OPTIMIZATION)).c_str());
+    std::fprintf(file, "  \"cplusplus\": %ld,\n", static_cast<long>(__cplusplus));
+#ifdef BOOST_FOREACH_NO_RANGE_BASED_FOR
+    std::fprintf(file, "  \"lowering\": \"classic\",\n");
+#else
+    std::fprintf(file, "  \"lowering\": \"range-based for\",\n");
+#endif
+#ifdef BOOST_FOREACH_DEBUG_FAST
+    std::fprintf(file, "  \"debug_fast\": true,\n");
+#else
+    std::fprintf(file, "  \"debug_fast\": false,\n");
+#endif
+#ifdef BOOST_FOREACH_NO_CONTIGUOUS
+    std::fprintf(file, "  \"contiguous\": false,\n");
+#else
+    std::fprintf(file, "  \"contiguous\": true,\n");
+#endif
+    std::fprintf(file, "  \"results\": [");
+    for(std::size_t i = 0; i < results().size(); ++i)
+    {
+        result const &r = results()[i];
+        std::fprintf(file, "%s\n    {\"group\": %s, \"name\": %s, \"ns_per_element\": %.4f}",
+            i ? "," : "", json_string(r.group).c_str(), json_string(r.name).c_str(), r.ns_per_element);
+    }
+    std::fprintf(file, "\n  ]\n}\n");
+    return 0 == std::fclose(file);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// finish
+//   Call at the end of main. If a path was given on the command line, the
+//   results are written there as JSON.
+inline int finish(int argc, char *argv[])
+{
+    if(argc < 2)
+        return 0;
+    if(write_json(argv[1], argv[0]))
+        return 0;
+    std::fprintf(stderr, "cannot write %s\n", argv[1]);
+    return 1;
+}
+
+} // namespace bench
+
+#endif
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+#
+# Copyright 2026 agent
+# Distributed under the Boost Software License, Version 1.0.
+# https://www.boost.org/LICENSE_1_0.txt
+
+"""Measure what BOOST_FOREACH's exception specifications save in object code.
+
+Compiles the tests that iterate the standard collections (STL containers,
+arrays, C strings, pairs of iterators and rvalues of each) with each
+implementation of BOOST_FOREACH, as it is and with BOOST_FOREACH_NO_NOEXCEPT,
+and adds up the sizes of the sections of the object files:
+
+  text      the code
+  eh_frame  the unwind tables
+  except    the landing pads' call-site tables (.gcc_except_table)
+
+The comparison is at each optimization level given; an unoptimized build,
+which calls the functions of foreach_detail_ rather than inlining them, is
+where the unwind tables are largest. Sizes are read with the binutils size
+command, so the script needs a toolchain that writes ELF objects.
+Flags starting with a dash must be passed as --flags="-std=c++17 ...".
+"""
+
+import argparse
+import json
+import os
+import platform
+import shlex
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+INCLUDE = os.path.join(HERE, '..', 'include')
+TESTS = os.path.join(HERE, '..', 'test')
+
+SOURCES = [
+    'stl_byval', 'stl_byref', 'stl_byval_r', 'stl_byref_r',
+    'array_byval', 'array_byref', 'array_byval_r', 'array_byref_r',
+    'cstr_byval', 'cstr_byref', 'cstr_byval_r', 'cstr_byref_r',
+    'pair_byval', 'pair_byref', 'pair_byval_r', 'pair_byref_r',
+    'rvalue_const', 'rvalue_nonconst', 'rvalue_const_r', 'rvalue_nonconst_r',
+]
+
+VARIANTS = [
+    ('full', []),
+    ('full, no noexcept', ['-DBOOST_FOREACH_NO_NOEXCEPT']),
+    ('classic', ['-DBOOST_FOREACH_NO_RANGE_BASED_FOR']),
+    ('classic, no noexcept', ['-DBOOST_FOREACH_NO_RANGE_BASED_FOR', '-DBOOST_FOREACH_NO_NOEXCEPT']),
+]
+
+SECTIONS = [
+    ('text', '.text'),
+    ('eh_frame', '.eh_frame'),
+    ('except', '.gcc_except_table'),
+]
+
+
+def sections(args, obj):
+    sizes = dict((name, 0) for name, _ in SECTIONS)
+    output = subprocess.check_output([args.size, '-A', obj], universal_newlines=True)
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) < 2 or not fields[1].isdigit():
+            continue
+        for name, prefix in SECTIONS:
+            # template instantiations go in sections of their own, like .text._Z...
+            if fields[0] == prefix or fields[0].startswith(prefix + '.'):
+                sizes[name] += int(fields[1])
+    return sizes
+
+
+def measure(args, level, name, defines, directory):
+    totals = dict((n, 0) for n, _ in SECTIONS)
+    for source in SOURCES:
+        obj = os.path.join(directory, source + '.o')
+        subprocess.check_call(
+            [args.cxx] + shlex.split(args.flags) + ['-' + level] + defines +
+            ['-I' + INCLUDE, '-c', os.path.join(TESTS, source + '.cpp'), '-o', obj])
+        for n, size in sections(args, obj).items():
+            totals[n] += size
+    totals['name'] = name
+    totals['level'] = level
+    return totals
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--cxx', default=os.environ.get('CXX', 'c++'),
+                        help='the compiler to measure (default: $CXX or c++)')
+    parser.add_argument('--size', default='size',
+                        help='the binutils size command (default: %(default)s)')
+    parser.add_argument('--flags', default='-std=c++11 -DNDEBUG',
+                        help='compiler flags (default: %(default)s)')
+    parser.add_argument('--levels', default='O0,O2',
+                        help='comma-separated optimization levels (default: %(default)s)')
+    parser.add_argument('--json', metavar='PATH',
+                        help='also write the results to PATH as JSON')
+    args = parser.parse_args()
+
+    results = []
+    with tempfile.TemporaryDirectory() as directory:
+        for level in args.levels.split(','):
+            for name, defines in VARIANTS:
+                results.append(measure(args, level, name, defines, directory))
+
+    print('%-4s %-22s %10s %10s %10s' % ('', '', 'text', 'eh_frame', 'except'))
+    for r in results:
+        print('%-4s %-22s %10d %10d %10d' % (r['level'], r['name'], r['text'], r['eh_frame'], r['except']))
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump({
+                'benchmark': 'binary_size',
+                'compiler': subprocess.check_output([args.cxx, '--version'], universal_newlines=True).splitlines()[0],
+                'platform': platform.system(),
+                'flags': args.flags,
+                'sources': SOURCES,
+                'results': results,
+            }, f, indent=2)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,112 @@
+//  bits.cpp
+//
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+// Times BOOST_FOREACH over a std::vector<bool>, which it iterates a word at a
+// time, against a loop over its iterators, and BOOST_FOREACH_SET_BIT over
+// std::vector<bool>, std::bitset and boost::dynamic_bitset against a loop that
+// tests every bit, with 1%, 10%, 50% and 90% of the bits set. Build with
+// BOOST_FOREACH_NO_SEGMENTED for the BOOST_FOREACH numbers of the bit-at-a-time
+// path. (std::vector<bool> is only iterated a word at a time with libstdc++.)
+#define BOOST_FOREACH_LIBRARY_SEGMENTS
+
+#include <bitset>
+#include <vector>
+#include <string>
+#include <boost/dynamic_bitset.hpp>
+#include <boost/foreach.hpp>
+#include <boost/foreach_set_bit.hpp>
+#include "./bench.hpp"
+
+std::size_t const size = 1 << 16;
+
+///////////////////////////////////////////////////////////////////////////////
+// the loops
+//
+BOOST_NOINLINE unsigned foreach_loop(std::vector<bool> const &bits)
+{
+    unsigned count = 0;
+    BOOST_FOREACH(bool b, bits)
+        count += b;
+    return count;
+}
+
+BOOST_NOINLINE unsigned iterator_loop(std::vector<bool> const &bits)
+{
+    unsigned count = 0;
+    for(std::vector<bool>::const_iterator it = bits.begin(), end = bits.end(); it != end; ++it)
+        count += *it;
+    return count;
+}
+
+template<typename Bits>
+BOOST_NOINLINE std::size_t set_bit_loop(Bits const &bits)
+{
+    std::size_t sum = 0;
+    BOOST_FOREACH_SET_BIT(std::size_t i, bits)
+        sum += i;
+    return sum;
+}
+
+template<typename Bits>
+BOOST_NOINLINE std::size_t index_loop(Bits const &bits)
+{
+    std::size_t sum = 0;
+    for(std::size_t i = 0, n = bits.size(); i != n; ++i)
+        if(bits[i])
+            sum += i;
+    return sum;
+}
+
+template<typename Bits>
+void run(std::string const &group, Bits const &bits)
+{
+    std::size_t const n = size;
+    bench::report(group, "BOOST_FOREACH_SET_BIT",
+        bench::measure([&] { bench::do_not_optimize(set_bit_loop(bits)); }, n));
+    bench::report(group, "index loop",
+        bench::measure([&] { bench::do_not_optimize(index_loop(bits)); }, n));
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<bool> all(size, true);
+    bench::report("std::vector<bool>", "BOOST_FOREACH",
+        bench::measure([&] { bench::do_not_optimize(foreach_loop(all)); }, size));
+    bench::report("std::vector<bool>", "iterator loop",
+        bench::measure([&] { bench::do_not_optimize(iterator_loop(all)); }, size));
+
+    int const densities[] = {1, 10, 50, 90};
+    BOOST_FOREACH(int density, densities)
+    {
+        std::vector<bool> vector_bool(size);
+        std::bitset<size> bitset;
+        boost::dynamic_bitset<> dynamic_bitset(size);
+
+        // the same pseudo-random bits in each
+        unsigned seed = 1;
+        for(std::size_t i = 0; i != size; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+            bool const b = static_cast<int>((seed >> 16) % 100) < density;
+            vector_bool[i] = b;
+            bitset[i] = b;
+            dynamic_bitset[i] = b;
+        }
+
+        std::string const percent = " " + std::to_string(density) + "%";
+        run("std::vector<bool>" + percent, vector_bool);
+        run("std::bitset" + percent, bitset);
+        run("boost::dynamic_bitset" + percent, dynamic_bitset);
+    }
+
+    return bench::finish(argc, argv);
+}
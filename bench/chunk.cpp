@@ -0,0 +1,108 @@
+//  chunk.cpp
+//
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+// Times BOOST_FOREACH_CHUNK, handing blocks of 8, 64 and 512 elements to a
+// kernel that takes a pointer and a length, against a per-element BOOST_FOREACH
+// doing the same sum of squares, over the collections of the stl_* and array_*
+// tests. The kernel keeps eight partial sums, as a SIMD kernel would; the
+// per-element loop cannot, since the compiler may not reorder float additions.
+// For the contiguous collections, the kernel over the whole collection is the
+// best that can be done.
+
+#include <list>
+#include <deque>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <boost/array.hpp>
+#include <boost/foreach.hpp>
+#include "./bench.hpp"
+
+std::size_t const size = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+// kernel
+//
+BOOST_NOINLINE float kernel(float const *p, std::size_t n)
+{
+    float partial[8] = {0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f};
+    std::size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        for(std::size_t j = 0; j != 8; ++j)
+            partial[j] += p[i + j] * p[i + j];
+    }
+    for(; i != n; ++i)
+        partial[0] += p[i] * p[i];
+    float sum = 0.f;
+    for(std::size_t j = 0; j != 8; ++j)
+        sum += partial[j];
+    return sum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the loops
+//
+template<typename Col>
+BOOST_NOINLINE float foreach_loop(Col const &col)
+{
+    float sum = 0.f;
+    BOOST_FOREACH(float x, col)
+        sum += x * x;
+    return sum;
+}
+
+template<std::size_t N, typename Col>
+BOOST_NOINLINE float chunk_loop(Col const &col)
+{
+    float sum = 0.f;
+    BOOST_FOREACH_CHUNK(boost::foreach::chunk<float const> c, col, N)
+        sum += kernel(c.data(), c.size());
+    return sum;
+}
+
+template<typename Col>
+void run(std::string const &group, Col const &col)
+{
+    bench::report(group, "BOOST_FOREACH",
+        bench::measure([&] { bench::do_not_optimize(foreach_loop(col)); }, size));
+    bench::report(group, "BOOST_FOREACH_CHUNK, N=8",
+        bench::measure([&] { bench::do_not_optimize(chunk_loop<8>(col)); }, size));
+    bench::report(group, "BOOST_FOREACH_CHUNK, N=64",
+        bench::measure([&] { bench::do_not_optimize(chunk_loop<64>(col)); }, size));
+    bench::report(group, "BOOST_FOREACH_CHUNK, N=512",
+        bench::measure([&] { bench::do_not_optimize(chunk_loop<512>(col)); }, size));
+}
+
+template<typename Col>
+void run_contiguous(std::string const &group, Col const &col)
+{
+    run(group, col);
+    bench::report(group, "kernel",
+        bench::measure([&] { bench::do_not_optimize(kernel(&*col.begin(), size)); }, size));
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<float> vector_float(size, 1.5f);
+    boost::array<float, size> array_float;
+    array_float.fill(1.5f);
+    std::deque<float> deque_float(size, 1.5f);
+    std::list<float> list_float(size, 1.5f);
+
+    run_contiguous("std::vector<float>", vector_float);
+    run_contiguous("boost::array<float>", array_float);
+    run("std::deque<float>", deque_float);
+    run("std::list<float>", list_float);
+
+    return bench::finish(argc, argv);
+}
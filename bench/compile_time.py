@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+#
+# Copyright 2026 agent
+# Distributed under the Boost Software License, Version 1.0.
+# https://www.boost.org/LICENSE_1_0.txt
+
+"""Measure what BOOST_FOREACH costs the compiler.
+
+Generates translation units with 0 and N loops, each over a collection of a
+different element type so that every loop instantiates its own templates, and
+times the compiler on them with each implementation of BOOST_FOREACH:
+
+  full      <boost/foreach.hpp>, lowered to a range-based for
+  classic   <boost/foreach.hpp> with BOOST_FOREACH_NO_RANGE_BASED_FOR
+  lite      <boost/foreach_lite.hpp>
+  for       a plain range-based for, for reference
+
+For each it reports the size of the preprocessed header, the time to
+preprocess and to parse a file with no loops (the cost of the #include), and
+the parse time added by each loop (the cost of instantiation). Times are the
+best of several runs of -E and -fsyntax-only, so code generation is left out.
+Flags starting with a dash must be passed as --flags="-std=c++17 ...".
+"""
+
+import argparse
+import json
+import os
+import platform
+import shlex
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+INCLUDE = os.path.join(HERE, '..', 'include')
+
+VARIANTS = [
+    ('full', '#include <boost/foreach.hpp>', []),
+    ('classic', '#include <boost/foreach.hpp>', ['-DBOOST_FOREACH_NO_RANGE_BASED_FOR']),
+    ('lite', '#include <boost/foreach_lite.hpp>', []),
+    ('for', '', []),
+]
+
+# the loops alternate between these parameter declarations
+PARAMETERS = [
+    'std::vector<elem<%d> > const &col',
+    'std::list<elem<%d> > const &col',
+    'elem<%d> const (&col)[4]',
+]
+
+
+def source(header, loops, native):
+    lines = [
+        '#include <list>',
+        '#include <vector>',
+        header,
+        'template<int N> struct elem { int value; };',
+    ]
+    for i in range(loops):
+        kind = 'REVERSE_' if i % 4 == 3 else ''
+        lines.append('int loop%d(%s)' % (i, PARAMETERS[i % len(PARAMETERS)] % i))
+        lines.append('{')
+        lines.append('    int sum = 0;')
+        if native:
+            lines.append('    for(elem<%d> const &e : col)' % i)
+        else:
+            lines.append('    BOOST_%sFOREACH(elem<%d> const &e, col)' % (kind, i))
+        lines.append('        sum += e.value;')
+        lines.append('    return sum;')
+        lines.append('}')
+    return '\n'.join(lines) + '\n'
+
+
+def best_time(command, repetitions):
+    best = None
+    for _ in range(repetitions):
+        start = time.perf_counter()
+        subprocess.check_call(command, stdout=subprocess.DEVNULL)
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return best
+
+
+def measure(args, name, header, defines, directory):
+    native = name == 'for'
+    base = [args.cxx] + shlex.split(args.flags) + defines + ['-I' + INCLUDE]
+    empty = os.path.join(directory, name + '_0.cpp')
+    full = os.path.join(directory, name + '_%d.cpp' % args.loops)
+    with open(empty, 'w') as f:
+        f.write(source(header, 0, native))
+    with open(full, 'w') as f:
+        f.write(source(header, args.loops, native))
+
+    preprocessed = subprocess.check_output(base + ['-E', empty], universal_newlines=True)
+    empty_parse = best_time(base + ['-fsyntax-only', empty], args.repetitions)
+    full_parse = best_time(base + ['-fsyntax-only', full], args.repetitions)
+    return {
+        'name': name,
+        'preprocessed_lines': preprocessed.count('\n'),
+        'preprocess_ms': 1000 * best_time(base + ['-E', empty], args.repetitions),
+        'include_ms': 1000 * empty_parse,
+        'per_loop_ms': 1000 * (full_parse - empty_parse) / args.loops,
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--cxx', default=os.environ.get('CXX', 'c++'),
+                        help='the compiler to measure (default: $CXX or c++)')
+    parser.add_argument('--flags', default='-std=c++11',
+                        help='compiler flags (default: %(default)s)')
+    parser.add_argument('--loops', type=int, default=300,
+                        help='loops in the large translation unit (default: %(default)s)')
+    parser.add_argument('--repetitions', type=int, default=5,
+                        help='runs of each command; the fastest counts (default: %(default)s)')
+    parser.add_argument('--json', metavar='PATH',
+                        help='also write the results to PATH as JSON')
+    args = parser.parse_args()
+
+    results = []
+    with tempfile.TemporaryDirectory() as directory:
+        for name, header, defines in VARIANTS:
+            results.append(measure(args, name, header, defines, directory))
+
+    print('%-8s %18s %14s %12s %14s' % ('', 'preprocessed lines', 'preprocess ms', 'include ms', 'ms per loop'))
+    for r in results:
+        print('%-8s %18d %14.1f %12.1f %14.3f' % (
+            r['name'], r['preprocessed_lines'], r['preprocess_ms'], r['include_ms'], r['per_loop_ms']))
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump({
+                'benchmark': 'compile_time',
+                'compiler': subprocess.check_output([args.cxx, '--version'], universal_newlines=True).splitlines()[0],
+                'platform': platform.system(),
+                'flags': args.flags,
+                'loops': args.loops,
+                'results': results,
+            }, f, indent=2)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
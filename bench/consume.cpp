@@ -0,0 +1,88 @@
+//  consume.cpp
+//
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   17 October 2026 : Initial version.
+*/
+
+// Times BOOST_FOREACH_CONSUME against BOOST_FOREACH, which copies each element
+// out of an rvalue collection, and against a hand-written loop that moves
+// them. Each loop takes the elements of a freshly made vector by value and
+// moves them into another, as code that transforms one container into another
+// does. The strings are too long for the small string buffer and the rows
+// are vectors of their own, so that each copy allocates.
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <boost/foreach.hpp>
+#include "./bench.hpp"
+
+std::size_t const size = 1024;
+
+template<typename T>
+BOOST_NOINLINE std::vector<T> make(T const &prototype)
+{
+    return std::vector<T>(size, prototype);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the loops
+//
+template<typename T>
+BOOST_NOINLINE std::size_t foreach_loop(T const &prototype, std::vector<T> &out)
+{
+    out.clear();
+    BOOST_FOREACH(T t, make(prototype))
+        out.push_back(std::move(t));
+    return out.size();
+}
+
+template<typename T>
+BOOST_NOINLINE std::size_t consume_loop(T const &prototype, std::vector<T> &out)
+{
+    out.clear();
+    BOOST_FOREACH_CONSUME(T t, make(prototype))
+        out.push_back(std::move(t));
+    return out.size();
+}
+
+template<typename T>
+BOOST_NOINLINE std::size_t hand_loop(T const &prototype, std::vector<T> &out)
+{
+    out.clear();
+    std::vector<T> in = make(prototype);
+    for(typename std::vector<T>::iterator it = in.begin(); it != in.end(); ++it)
+    {
+        T t(std::move(*it));
+        out.push_back(std::move(t));
+    }
+    return out.size();
+}
+
+template<typename T>
+void run(std::string const &group, T const &prototype)
+{
+    std::vector<T> out;
+    out.reserve(size);
+
+    bench::report(group, "BOOST_FOREACH(T t, make())",
+        bench::measure([&] { bench::do_not_optimize(foreach_loop(prototype, out)); }, size));
+    bench::report(group, "BOOST_FOREACH_CONSUME(T t, make())",
+        bench::measure([&] { bench::do_not_optimize(consume_loop(prototype, out)); }, size));
+    bench::report(group, "hand-written loop with std::move",
+        bench::measure([&] { bench::do_not_optimize(hand_loop(prototype, out)); }, size));
+}
+
+int main(int argc, char *argv[])
+{
+    run("std::vector<std::string>", std::string(32, 's'));
+    run("std::vector<std::vector<int> >", std::vector<int>(16, 1));
+
+    return bench::finish(argc, argv);
+}
@@ -0,0 +1,138 @@
+//  contiguous.cpp
+//
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+// Times BOOST_FOREACH over the contiguous collections, which it iterates with
+// pointers, against hand-written loops using the collection's own iterators and
+// using pointers. The std::list and array of the stl_* and array_* tests are
+// included for reference: the first is not contiguous, the second was always
+// iterated with pointers. Build with BOOST_FOREACH_NO_CONTIGUOUS for the
+// BOOST_FOREACH numbers without the pointer fast path, and with _GLIBCXX_DEBUG
+// to see what it saves when the standard library checks its iterators.
+
+#include <list>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <boost/array.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/rend.hpp>
+#include <boost/range/rbegin.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/reverse_iterator.hpp>
+#include <boost/foreach.hpp>
+#include "./bench.hpp"
+#if !defined(BOOST_NO_CXX11_HDR_ARRAY)
+# include <array>
+#endif
+
+std::size_t const size = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+// the loops
+//
+template<typename Col>
+BOOST_NOINLINE unsigned foreach_loop(Col const &col)
+{
+    unsigned sum = 0;
+    BOOST_FOREACH(int x, col)
+        sum += static_cast<unsigned>(x);
+    return sum;
+}
+
+template<typename Col>
+BOOST_NOINLINE unsigned reverse_foreach_loop(Col const &col)
+{
+    unsigned sum = 0;
+    BOOST_REVERSE_FOREACH(int x, col)
+        sum += static_cast<unsigned>(x);
+    return sum;
+}
+
+template<typename Col>
+BOOST_NOINLINE unsigned iterator_loop(Col const &col)
+{
+    typedef typename boost::range_iterator<Col const>::type iterator;
+    unsigned sum = 0;
+    for(iterator it = boost::begin(col), end = boost::end(col); it != end; ++it)
+        sum += static_cast<unsigned>(*it);
+    return sum;
+}
+
+template<typename Col>
+BOOST_NOINLINE unsigned reverse_iterator_loop(Col const &col)
+{
+    typedef typename boost::range_reverse_iterator<Col const>::type iterator;
+    unsigned sum = 0;
+    for(iterator it = boost::rbegin(col), end = boost::rend(col); it != end; ++it)
+        sum += static_cast<unsigned>(*it);
+    return sum;
+}
+
+template<typename Col>
+BOOST_NOINLINE unsigned pointer_loop(Col const &col)
+{
+    unsigned sum = 0;
+    std::size_t const n = static_cast<std::size_t>(boost::end(col) - boost::begin(col));
+    if(0 != n)
+    {
+        for(int const *p = &*boost::begin(col), *end = p + n; p != end; ++p)
+            sum += static_cast<unsigned>(*p);
+    }
+    return sum;
+}
+
+template<typename Col>
+void run(std::string const &group, Col const &col)
+{
+    std::size_t const n = size;
+    bench::report(group, "BOOST_FOREACH",
+        bench::measure([&] { bench::do_not_optimize(foreach_loop(col)); }, n));
+    bench::report(group, "iterator loop",
+        bench::measure([&] { bench::do_not_optimize(iterator_loop(col)); }, n));
+    bench::report(group, "BOOST_REVERSE_FOREACH",
+        bench::measure([&] { bench::do_not_optimize(reverse_foreach_loop(col)); }, n));
+    bench::report(group, "reverse iterator loop",
+        bench::measure([&] { bench::do_not_optimize(reverse_iterator_loop(col)); }, n));
+}
+
+template<typename Col>
+void run_contiguous(std::string const &group, Col const &col)
+{
+    run(group, col);
+    bench::report(group, "pointer loop",
+        bench::measure([&] { bench::do_not_optimize(pointer_loop(col)); }, size));
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<int> vector_int(size, 1);
+    std::basic_string<int> string_int(size, 1);
+    boost::array<int, size> boost_array_int;
+    boost_array_int.fill(1);
+    int array_int[size];
+    std::fill(array_int, array_int + size, 1);
+    std::list<int> list_int(size, 1);
+
+    run_contiguous("std::vector<int>", vector_int);
+    run_contiguous("std::basic_string<int>", string_int);
+    run_contiguous("boost::array<int>", boost_array_int);
+#if !defined(BOOST_NO_CXX11_HDR_ARRAY)
+    std::array<int, size> std_array_int;
+    std_array_int.fill(1);
+    run_contiguous("std::array<int>", std_array_int);
+#endif
+    run_contiguous("int[]", array_int);
+    run("std::list<int>", list_int);
+
+    return bench::finish(argc, argv);
+}
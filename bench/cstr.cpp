@@ -0,0 +1,89 @@
+//  cstr.cpp
+//
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+// Compares BOOST_FOREACH over null-terminated strings, which locates the
+// terminator up front and then iterates over a bounded range, with the
+// character-at-a-time terminator test it used to perform on every iteration.
+
+#include <string>
+#include <boost/foreach.hpp>
+#include "./bench.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// the per-character termination test BOOST_FOREACH used to perform
+template<typename Char>
+unsigned checksum_terminator(Char const *str)
+{
+    unsigned sum = 0;
+    for(Char const *p = str; *p; ++p)
+        sum += static_cast<unsigned>(*p);
+    return sum;
+}
+
+template<typename Char>
+unsigned checksum_terminator_r(Char const *str)
+{
+    Char const *end = str;
+    while(*end)
+        ++end;
+    unsigned sum = 0;
+    while(end != str)
+        sum += static_cast<unsigned>(*--end);
+    return sum;
+}
+
+template<typename Char>
+unsigned checksum_foreach(Char const *str)
+{
+    unsigned sum = 0;
+    BOOST_FOREACH(Char ch, str)
+        sum += static_cast<unsigned>(ch);
+    return sum;
+}
+
+template<typename Char>
+unsigned checksum_foreach_r(Char const *str)
+{
+    unsigned sum = 0;
+    BOOST_REVERSE_FOREACH(Char ch, str)
+        sum += static_cast<unsigned>(ch);
+    return sum;
+}
+
+template<typename Char>
+void run(std::string const &group, std::size_t length)
+{
+    std::basic_string<Char> s(length, Char('x'));
+    Char const *str = s.c_str();
+
+    bench::report(group, "terminator check",
+        bench::measure([=] { bench::do_not_optimize(checksum_terminator(str)); }, length));
+    bench::report(group, "BOOST_FOREACH",
+        bench::measure([=] { bench::do_not_optimize(checksum_foreach(str)); }, length));
+    bench::report(group, "terminator check (reverse)",
+        bench::measure([=] { bench::do_not_optimize(checksum_terminator_r(str)); }, length));
+    bench::report(group, "BOOST_REVERSE_FOREACH",
+        bench::measure([=] { bench::do_not_optimize(checksum_foreach_r(str)); }, length));
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t const lengths[] = {16, 256, 4096, 65536};
+    BOOST_FOREACH(std::size_t length, lengths)
+    {
+        std::string group = "char[" + std::to_string(length) + "]";
+        run<char>(group, length);
+        group = "wchar_t[" + std::to_string(length) + "]";
+        run<wchar_t>(group, length);
+    }
+    return bench::finish(argc, argv);
+}
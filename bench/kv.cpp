@@ -0,0 +1,80 @@
+//  kv.cpp
+//
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+// Times BOOST_FOREACH_KV against the usual workaround for the comma in
+// std::pair<K, V>: a typedef for the pair, taken by value as is all too common,
+// and by reference. The maps hold strings too long for the small string buffer,
+// so that each copy of a pair allocates.
+
+#include <map>
+#include <string>
+#include <utility>
+#include <unordered_map>
+#include <boost/foreach.hpp>
+#include "./bench.hpp"
+
+std::size_t const size = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+// the loops
+//
+template<typename Map>
+BOOST_NOINLINE std::size_t byval_loop(Map const &m)
+{
+    typedef typename Map::value_type pair_t;
+    std::size_t total = 0;
+    BOOST_FOREACH(pair_t p, m)
+        total += p.first.size() + p.second.size();
+    return total;
+}
+
+template<typename Map>
+BOOST_NOINLINE std::size_t byref_loop(Map const &m)
+{
+    typedef typename Map::value_type pair_t;
+    std::size_t total = 0;
+    BOOST_FOREACH(pair_t const &p, m)
+        total += p.first.size() + p.second.size();
+    return total;
+}
+
+template<typename Map>
+BOOST_NOINLINE std::size_t kv_loop(Map const &m)
+{
+    std::size_t total = 0;
+    BOOST_FOREACH_KV(std::string const &key, std::string const &value, m)
+        total += key.size() + value.size();
+    return total;
+}
+
+template<typename Map>
+void run(std::string const &group)
+{
+    Map m;
+    for(std::size_t i = 0; i != size; ++i)
+        m[std::to_string(i) + std::string(32, 'k')] = std::string(32, 'v');
+
+    bench::report(group, "BOOST_FOREACH(pair_t p, m)",
+        bench::measure([&] { bench::do_not_optimize(byval_loop(m)); }, size));
+    bench::report(group, "BOOST_FOREACH(pair_t const &p, m)",
+        bench::measure([&] { bench::do_not_optimize(byref_loop(m)); }, size));
+    bench::report(group, "BOOST_FOREACH_KV",
+        bench::measure([&] { bench::do_not_optimize(kv_loop(m)); }, size));
+}
+
+int main(int argc, char *argv[])
+{
+    run<std::map<std::string, std::string> >("std::map<std::string, std::string>");
+    run<std::unordered_map<std::string, std::string> >("std::unordered_map<std::string, std::string>");
+
+    return bench::finish(argc, argv);
+}
@@ -0,0 +1,206 @@
+//  loops.cpp
+//
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+// Measures what the BOOST_FOREACH machinery costs by timing BOOST_FOREACH and
+// BOOST_REVERSE_FOREACH against a range-based for and a hand-written iterator
+// loop, over the same collections the correctness tests use. The loop body
+// just sums the elements, so the loop overhead dominates.
+
+#include <map>
+#include <list>
+#include <deque>
+#include <string>
+#include <vector>
+#include <utility>
+#include <boost/mpl/bool.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/rend.hpp>
+#include <boost/range/rbegin.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/reverse_iterator.hpp>
+#include <boost/foreach.hpp>
+#include "./bench.hpp"
+
+std::size_t const size = 10000;
+
+///////////////////////////////////////////////////////////////////////////////
+// value
+//   what the loop body adds up
+template<typename T>
+inline unsigned value(T const &t)
+{
+    return static_cast<unsigned>(t);
+}
+
+template<typename K, typename V>
+inline unsigned value(std::pair<K, V> const &p)
+{
+    return static_cast<unsigned>(p.second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the loops
+//
+template<typename Var, typename Col>
+BOOST_NOINLINE unsigned foreach_loop(Col const &col)
+{
+    unsigned sum = 0;
+    BOOST_FOREACH(Var x, col)
+        sum += value(x);
+    return sum;
+}
+
+template<typename Var, typename Col>
+BOOST_NOINLINE unsigned reverse_foreach_loop(Col const &col)
+{
+    unsigned sum = 0;
+    BOOST_REVERSE_FOREACH(Var x, col)
+        sum += value(x);
+    return sum;
+}
+
+template<typename Var, typename Col>
+BOOST_NOINLINE unsigned range_for_loop(Col const &col)
+{
+    unsigned sum = 0;
+    for(Var x : col)
+        sum += value(x);
+    return sum;
+}
+
+template<typename Var, typename Col>
+BOOST_NOINLINE unsigned iterator_loop(Col const &col)
+{
+    typedef typename boost::range_iterator<Col const>::type iterator;
+    unsigned sum = 0;
+    for(iterator it = boost::begin(col), end = boost::end(col); it != end; ++it)
+    {
+        Var x = *it;
+        sum += value(x);
+    }
+    return sum;
+}
+
+template<typename Var, typename Col>
+BOOST_NOINLINE unsigned reverse_iterator_loop(Col const &col)
+{
+    typedef typename boost::range_reverse_iterator<Col const>::type iterator;
+    unsigned sum = 0;
+    for(iterator it = boost::rbegin(col), end = boost::rend(col); it != end; ++it)
+    {
+        Var x = *it;
+        sum += value(x);
+    }
+    return sum;
+}
+
+// hand-written loops over null-terminated strings test for the terminator
+template<typename Var>
+BOOST_NOINLINE unsigned iterator_loop(char const *const &str)
+{
+    unsigned sum = 0;
+    for(char const *p = str; *p; ++p)
+    {
+        Var x = *p;
+        sum += value(x);
+    }
+    return sum;
+}
+
+template<typename Var>
+BOOST_NOINLINE unsigned reverse_iterator_loop(char const *const &str)
+{
+    char const *p = str;
+    while(*p)
+        ++p;
+    unsigned sum = 0;
+    while(p != str)
+    {
+        Var x = *--p;
+        sum += value(x);
+    }
+    return sum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// run
+//   times every loop over col, with the loop variable declared as Var
+template<typename Var, typename Col>
+void run_range_for(std::string const &, std::string const &, Col const &, boost::mpl::false_)
+{
+}
+
+template<typename Var, typename Col>
+void run_range_for(std::string const &group, std::string const &var, Col const &col, boost::mpl::true_)
+{
+    bench::report(group, "range-based for " + var,
+        bench::measure([&] { bench::do_not_optimize(range_for_loop<Var>(col)); }, size));
+}
+
+template<typename Var, typename Col, typename RangeFor>
+void run(std::string const &group, std::string const &var, Col const &col, RangeFor range_for)
+{
+    bench::report(group, "BOOST_FOREACH " + var,
+        bench::measure([&] { bench::do_not_optimize(foreach_loop<Var>(col)); }, size));
+    run_range_for<Var>(group, var, col, range_for);
+    bench::report(group, "iterator loop " + var,
+        bench::measure([&] { bench::do_not_optimize(iterator_loop<Var>(col)); }, size));
+    bench::report(group, "BOOST_REVERSE_FOREACH " + var,
+        bench::measure([&] { bench::do_not_optimize(reverse_foreach_loop<Var>(col)); }, size));
+    bench::report(group, "reverse iterator loop " + var,
+        bench::measure([&] { bench::do_not_optimize(reverse_iterator_loop<Var>(col)); }, size));
+}
+
+template<typename Value, typename Ref, typename Col, typename RangeFor>
+void run_both(std::string const &group, Col const &col, RangeFor range_for)
+{
+    run<Value>(group, "by value", col, range_for);
+    run<Ref>(group, "by reference", col, range_for);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// main
+//
+int main(int argc, char *argv[])
+{
+    std::vector<int> vector_int;
+    std::deque<int> deque_int;
+    std::list<int> list_int;
+    std::map<int, int> map_int;
+    static int array_int[size];
+    std::string str(size, 'x');
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        int n = static_cast<int>(i);
+        vector_int.push_back(n);
+        deque_int.push_back(n);
+        list_int.push_back(n);
+        map_int[n] = n;
+        array_int[i] = n;
+    }
+    std::pair<std::vector<int>::const_iterator, std::vector<int>::const_iterator>
+        pair_int(vector_int.begin(), vector_int.end());
+    char const *cstr = str.c_str();
+
+    typedef std::pair<int const, int> pair_t;
+
+    run_both<int, int const &>("std::vector<int>", vector_int, boost::mpl::true_());
+    run_both<int, int const &>("std::deque<int>", deque_int, boost::mpl::true_());
+    run_both<int, int const &>("std::list<int>", list_int, boost::mpl::true_());
+    run_both<pair_t, pair_t const &>("std::map<int,int>", map_int, boost::mpl::true_());
+    run_both<int, int const &>("int[]", array_int, boost::mpl::true_());
+    run_both<char, char const &>("char const *", cstr, boost::mpl::false_());
+    run_both<int, int const &>("std::pair<It,It>", pair_int, boost::mpl::false_());
+
+    return bench::finish(argc, argv);
+}
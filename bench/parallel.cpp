@@ -0,0 +1,87 @@
+//  parallel.cpp
+//
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+// Times BOOST_PARALLEL_FOREACH on 1, 2, 4, ... threads, up to twice the number
+// of cores, against a serial BOOST_FOREACH. There are two bodies: a cheap one,
+// which shows what a loop costs to share out, and one that does enough work per
+// element for the loop to scale. "threads=N" is BOOST_PARALLEL_FOREACH with
+// boost::foreach::set_parallel_concurrency(N).
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <thread>
+#include <boost/foreach.hpp>
+#include <boost/foreach_parallel.hpp>
+#include "./bench.hpp"
+
+std::size_t const size = 1 << 20;
+
+///////////////////////////////////////////////////////////////////////////////
+// the bodies
+//
+inline double cheap(double x)
+{
+    return x * 2.0 + 1.0;
+}
+
+inline double costly(double x)
+{
+    for(int i = 0; i != 16; ++i)
+        x = std::sqrt(x + 1.0) + std::sin(x);
+    return x;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the loops
+//
+template<double (*Body)(double)>
+BOOST_NOINLINE void foreach_loop(std::vector<double> &v)
+{
+    BOOST_FOREACH(double &x, v)
+        x = Body(x);
+}
+
+template<double (*Body)(double)>
+BOOST_NOINLINE void parallel_loop(std::vector<double> &v)
+{
+    BOOST_PARALLEL_FOREACH(double &x, v)
+    {
+        x = Body(x);
+    };
+}
+
+template<double (*Body)(double)>
+void run(std::string const &group, std::size_t elements)
+{
+    std::vector<double> v(elements, 1.0);
+    bench::report(group, "BOOST_FOREACH",
+        bench::measure([&] { foreach_loop<Body>(v); bench::do_not_optimize(v[0]); }, elements));
+
+    unsigned const cores = std::thread::hardware_concurrency();
+    unsigned const most = 0 != cores ? 2 * cores : 2;
+    for(unsigned threads = 1; threads <= most; threads *= 2)
+    {
+        boost::foreach::set_parallel_concurrency(threads);
+        bench::report(group, "threads=" + std::to_string(threads),
+            bench::measure([&] { parallel_loop<Body>(v); bench::do_not_optimize(v[0]); }, elements));
+    }
+    boost::foreach::set_parallel_concurrency(0);
+}
+
+int main(int argc, char *argv[])
+{
+    run<cheap>("cheap body", size);
+    run<costly>("costly body", size / 16);
+
+    return bench::finish(argc, argv);
+}
@@ -0,0 +1,178 @@
+//  prefetch.cpp
+//
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+// Times BOOST_FOREACH_PREFETCH with distances of 2, 4 and 8 against
+// BOOST_FOREACH over a std::list and a std::map whose nodes are scattered
+// through memory, at sizes that fit in L2, that fit in L3 and that do not fit
+// in cache at all. There are two bodies: a cheap one, for which the loop is
+// nothing but the walk from node to node, and a costly one, which takes about
+// as long as a trip to memory and which the prefetches can overlap with. On Linux, the cache misses per element are counted as well,
+// where the kernel allows it; they are printed, but not written to the JSON.
+
+#include <map>
+#include <list>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <boost/foreach.hpp>
+#include "./bench.hpp"
+
+#if defined(__linux__)
+# include <unistd.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <linux/perf_event.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// cache_misses
+//   Counts the cache misses f causes, per element, or returns a negative
+//   number if they cannot be counted.
+template<typename F>
+double cache_misses(F f, std::size_t elements)
+{
+#if defined(__linux__)
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    if(-1 == fd)
+        return -1.;
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    f();
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    long long count = 0;
+    bool const read_ok = sizeof(count) == read(fd, &count, sizeof(count));
+    close(fd);
+    return read_ok ? static_cast<double>(count) / static_cast<double>(elements) : -1.;
+#else
+    (void)f;
+    (void)elements;
+    return -1.;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the loops
+//
+inline int value(int i)
+{
+    return i;
+}
+
+inline int value(std::pair<int const, int> const &p)
+{
+    return p.second;
+}
+
+// About as long as a trip to memory
+inline long long costly(int i)
+{
+    long long x = i;
+    for(int j = 0; j != 64; ++j)
+        x = x * 31 + 7;
+    return x;
+}
+
+inline long long cheap(int i)
+{
+    return i;
+}
+
+template<long long (*Body)(int), typename Col>
+BOOST_NOINLINE long long foreach_loop(Col const &col)
+{
+    long long sum = 0;
+    BOOST_FOREACH(BOOST_DEDUCED_TYPENAME Col::const_reference x, col)
+        sum += Body(value(x));
+    return sum;
+}
+
+template<long long (*Body)(int), std::size_t Distance, typename Col>
+BOOST_NOINLINE long long prefetch_loop(Col const &col)
+{
+    long long sum = 0;
+    BOOST_FOREACH_PREFETCH(BOOST_DEDUCED_TYPENAME Col::const_reference x, col, Distance)
+        sum += Body(value(x));
+    return sum;
+}
+
+template<typename F>
+void run_one(std::string const &group, std::string const &name, F f, std::size_t elements)
+{
+    bench::report(group, name, bench::measure(f, elements, 3));
+    double const misses = cache_misses(f, elements);
+    if(0. <= misses)
+        std::printf("%-24s %-40s %10.3f misses/elem\n", group.c_str(), name.c_str(), misses);
+}
+
+template<long long (*Body)(int), typename Col>
+void run(std::string const &group, Col const &col)
+{
+    run_one(group, "BOOST_FOREACH",
+        [&] { bench::do_not_optimize(foreach_loop<Body>(col)); }, col.size());
+    run_one(group, "BOOST_FOREACH_PREFETCH, DISTANCE=2",
+        [&] { bench::do_not_optimize(prefetch_loop<Body, 2>(col)); }, col.size());
+    run_one(group, "BOOST_FOREACH_PREFETCH, DISTANCE=4",
+        [&] { bench::do_not_optimize(prefetch_loop<Body, 4>(col)); }, col.size());
+    run_one(group, "BOOST_FOREACH_PREFETCH, DISTANCE=8",
+        [&] { bench::do_not_optimize(prefetch_loop<Body, 8>(col)); }, col.size());
+}
+
+// The keys in a random order, so that neighbouring nodes are not neighbours in memory
+std::vector<int> shuffled(std::size_t size)
+{
+    std::vector<int> keys(size);
+    for(std::size_t i = 0; i != size; ++i)
+        keys[i] = static_cast<int>(i);
+    unsigned state = 1;
+    for(std::size_t i = size; i > 1; --i)
+    {
+        state = state * 1103515245u + 12345u;
+        std::swap(keys[i - 1], keys[(state >> 8) % i]);
+    }
+    return keys;
+}
+
+void run_size(std::string const &label, std::size_t size)
+{
+    std::vector<int> const keys = shuffled(size);
+
+    // sorting a list relinks its nodes, but does not move them
+    std::list<int> l(keys.begin(), keys.end());
+    l.sort();
+    run<cheap>("std::list " + label, l);
+    run<costly>("std::list " + label + " costly", l);
+
+    std::map<int, int> m;
+    BOOST_FOREACH(int key, keys)
+        m[key] = key;
+    run<cheap>("std::map " + label, m);
+    run<costly>("std::map " + label + " costly", m);
+}
+
+int main(int argc, char *argv[])
+{
+    run_size("16K", 1 << 14);
+    run_size("256K", 1 << 18);
+    run_size("2M", 1 << 21);
+
+    return bench::finish(argc, argv);
+}
@@ -0,0 +1,103 @@
+//  segmented.cpp
+//
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+// Times BOOST_FOREACH over the segmented collections, which it iterates a block
+// at a time with pointers, against hand-written loops using the collection's
+// own iterators. The circular_buffer is full and wrapped around, so that it is
+// two blocks. Build with BOOST_FOREACH_NO_SEGMENTED for the BOOST_FOREACH
+// numbers of the element-at-a-time path. (std::deque is only segmented with
+// libstdc++.)
+#define BOOST_FOREACH_LIBRARY_SEGMENTS
+
+#include <deque>
+#include <string>
+#include <boost/circular_buffer.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/foreach.hpp>
+#include "./bench.hpp"
+
+std::size_t const size = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+// the loops
+//
+template<typename Col>
+BOOST_NOINLINE unsigned foreach_loop(Col const &col)
+{
+    unsigned sum = 0;
+    BOOST_FOREACH(int x, col)
+        sum += static_cast<unsigned>(x);
+    return sum;
+}
+
+template<typename Col>
+BOOST_NOINLINE unsigned iterator_loop(Col const &col)
+{
+    typedef typename boost::range_iterator<Col const>::type iterator;
+    unsigned sum = 0;
+    for(iterator it = boost::begin(col), end = boost::end(col); it != end; ++it)
+        sum += static_cast<unsigned>(*it);
+    return sum;
+}
+
+// stops at the first negative element, of which there are none
+template<typename Col>
+BOOST_NOINLINE unsigned foreach_search_loop(Col const &col)
+{
+    unsigned sum = 0;
+    BOOST_FOREACH(int x, col)
+    {
+        if(x < 0)
+            break;
+        sum += static_cast<unsigned>(x);
+    }
+    return sum;
+}
+
+template<typename Col>
+BOOST_NOINLINE unsigned iterator_search_loop(Col const &col)
+{
+    typedef typename boost::range_iterator<Col const>::type iterator;
+    unsigned sum = 0;
+    for(iterator it = boost::begin(col), end = boost::end(col); it != end && !(*it < 0); ++it)
+        sum += static_cast<unsigned>(*it);
+    return sum;
+}
+
+template<typename Col>
+void run(std::string const &group, Col const &col)
+{
+    std::size_t const n = size;
+    bench::report(group, "BOOST_FOREACH",
+        bench::measure([&] { bench::do_not_optimize(foreach_loop(col)); }, n));
+    bench::report(group, "iterator loop",
+        bench::measure([&] { bench::do_not_optimize(iterator_loop(col)); }, n));
+    bench::report(group, "BOOST_FOREACH with break",
+        bench::measure([&] { bench::do_not_optimize(foreach_search_loop(col)); }, n));
+    bench::report(group, "iterator loop with break",
+        bench::measure([&] { bench::do_not_optimize(iterator_search_loop(col)); }, n));
+}
+
+int main(int argc, char *argv[])
+{
+    std::deque<int> deque_int(size, 1);
+    boost::circular_buffer<int> circular_buffer_int(size);
+    for(std::size_t i = 0; i != size + size / 2; ++i)
+        circular_buffer_int.push_back(1);
+
+    run("std::deque<int>", deque_int);
+    run("boost::circular_buffer<int>", circular_buffer_int);
+
+    return bench::finish(argc, argv);
+}
@@ -0,0 +1,96 @@
+//  unrolled.cpp
+//
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+// Times BOOST_FOREACH_UNROLLED with K=2, 4 and 8 against BOOST_FOREACH, over
+// a small array, which BOOST_FOREACH_UNROLLED unrolls completely whatever K is,
+// and over a large array, a std::vector and a std::list. The body is a sum of
+// the elements that skips the odd ones, so that it has a branch of its own and
+// the loops are left as loops.
+
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/array.hpp>
+#include <boost/foreach.hpp>
+#include "./bench.hpp"
+
+std::size_t const size = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+// the loops
+//
+template<typename Col>
+BOOST_NOINLINE int foreach_loop(Col const &col)
+{
+    int sum = 0;
+    BOOST_FOREACH(int i, col)
+    {
+        if(0 != (i & 1))
+            continue;
+        sum += i;
+    }
+    return sum;
+}
+
+#define UNROLLED_LOOP(K)                                                        \
+    template<typename Col>                                                      \
+    BOOST_NOINLINE int unrolled_loop_ ## K(Col const &col)                      \
+    {                                                                           \
+        int sum = 0;                                                            \
+        BOOST_FOREACH_UNROLLED(int i, col, K)                                   \
+        {                                                                       \
+            if(0 != (i & 1))                                                    \
+                continue;                                                       \
+            sum += i;                                                           \
+        }                                                                       \
+        return sum;                                                             \
+    }
+
+UNROLLED_LOOP(2)
+UNROLLED_LOOP(4)
+UNROLLED_LOOP(8)
+
+#undef UNROLLED_LOOP
+
+// Loops over a small collection are timed many at a time.
+template<typename Col>
+void run(std::string const &group, std::vector<Col> const &cols, std::size_t elements)
+{
+    bench::report(group, "BOOST_FOREACH",
+        bench::measure([&] { BOOST_FOREACH(Col const &col, cols) bench::do_not_optimize(foreach_loop(col)); }, elements));
+    bench::report(group, "BOOST_FOREACH_UNROLLED, K=2",
+        bench::measure([&] { BOOST_FOREACH(Col const &col, cols) bench::do_not_optimize(unrolled_loop_2(col)); }, elements));
+    bench::report(group, "BOOST_FOREACH_UNROLLED, K=4",
+        bench::measure([&] { BOOST_FOREACH(Col const &col, cols) bench::do_not_optimize(unrolled_loop_4(col)); }, elements));
+    bench::report(group, "BOOST_FOREACH_UNROLLED, K=8",
+        bench::measure([&] { BOOST_FOREACH(Col const &col, cols) bench::do_not_optimize(unrolled_loop_8(col)); }, elements));
+}
+
+int main(int argc, char *argv[])
+{
+    boost::array<int, 8> small;
+    boost::array<int, size> large;
+    for(std::size_t i = 0; i != size; ++i)
+    {
+        small[i % 8] = static_cast<int>(i);
+        large[i] = static_cast<int>(i);
+    }
+    std::vector<int> vector_int(large.begin(), large.end());
+    std::list<int> list_int(large.begin(), large.end());
+
+    run("boost::array<int, 8>", std::vector<boost::array<int, 8> >(size / 8, small), size);
+    run("boost::array<int, 4096>", std::vector<boost::array<int, size> >(1, large), size);
+    run("std::vector<int>", std::vector<std::vector<int> >(1, vector_int), size);
+    run("std::list<int>", std::vector<std::list<int> >(1, list_int), size);
+
+    return bench::finish(argc, argv);
+}
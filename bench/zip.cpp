@@ -0,0 +1,101 @@
+//  zip.cpp
+//
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+// Times BOOST_FOREACH_ZIP against the hand-written loops it replaces: an index
+// loop over two and over three std::vectors, and a loop advancing a vector
+// iterator and a list iterator together.
+
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/foreach.hpp>
+#include "./bench.hpp"
+
+std::size_t const size = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+// two vectors
+//
+BOOST_NOINLINE void index_loop2(std::vector<float> &out, std::vector<float> const &a)
+{
+    std::size_t const n = out.size() < a.size() ? out.size() : a.size();
+    for(std::size_t i = 0; i != n; ++i)
+        out[i] = a[i] * 2.f;
+}
+
+BOOST_NOINLINE void zip_loop2(std::vector<float> &out, std::vector<float> const &a)
+{
+    BOOST_FOREACH_ZIP((float &o, out)(float x, a))
+        o = x * 2.f;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// three vectors
+//
+BOOST_NOINLINE void index_loop3(std::vector<float> &out, std::vector<float> const &a, std::vector<float> const &b)
+{
+    std::size_t n = out.size();
+    if(a.size() < n)
+        n = a.size();
+    if(b.size() < n)
+        n = b.size();
+    for(std::size_t i = 0; i != n; ++i)
+        out[i] = a[i] * b[i];
+}
+
+BOOST_NOINLINE void zip_loop3(std::vector<float> &out, std::vector<float> const &a, std::vector<float> const &b)
+{
+    BOOST_FOREACH_ZIP((float &o, out)(float x, a)(float y, b))
+        o = x * y;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// a vector and a list
+//
+BOOST_NOINLINE float iterator_loop(std::vector<float> const &a, std::list<float> const &b)
+{
+    float sum = 0.f;
+    std::vector<float>::const_iterator i = a.begin();
+    std::list<float>::const_iterator j = b.begin();
+    for(; i != a.end() && j != b.end(); ++i, ++j)
+        sum += *i * *j;
+    return sum;
+}
+
+BOOST_NOINLINE float zip_loop_mixed(std::vector<float> const &a, std::list<float> const &b)
+{
+    float sum = 0.f;
+    BOOST_FOREACH_ZIP((float x, a)(float y, b))
+        sum += x * y;
+    return sum;
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<float> out(size), a(size, 1.5f), b(size, 2.5f);
+    std::list<float> l(size, 2.5f);
+
+    bench::report("two vectors", "index loop",
+        bench::measure([&] { index_loop2(out, a); bench::do_not_optimize(out[0]); }, size));
+    bench::report("two vectors", "BOOST_FOREACH_ZIP",
+        bench::measure([&] { zip_loop2(out, a); bench::do_not_optimize(out[0]); }, size));
+    bench::report("three vectors", "index loop",
+        bench::measure([&] { index_loop3(out, a, b); bench::do_not_optimize(out[0]); }, size));
+    bench::report("three vectors", "BOOST_FOREACH_ZIP",
+        bench::measure([&] { zip_loop3(out, a, b); bench::do_not_optimize(out[0]); }, size));
+    bench::report("vector and list", "iterator loop",
+        bench::measure([&] { bench::do_not_optimize(iterator_loop(a, l)); }, size));
+    bench::report("vector and list", "BOOST_FOREACH_ZIP",
+        bench::measure([&] { bench::do_not_optimize(zip_loop_mixed(a, l)); }, size));
+
+    return bench::finish(argc, argv);
+}
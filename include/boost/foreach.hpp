@@ -17,6 +17,23 @@
 //  David Jenkins     - For help finding a Microsoft Code Analysis bug
 //  mimomorin@...     - For a patch to use rvalue refs on supporting compilers
 
+// BOOST_FOREACH_PERF_COUNTERS and BOOST_FOREACH_TRACE extend the profile of
+// BOOST_FOREACH_PROFILE.
+#if (defined(BOOST_FOREACH_PERF_COUNTERS) || defined(BOOST_FOREACH_TRACE)) && !defined(BOOST_FOREACH_PROFILE)
+# define BOOST_FOREACH_PROFILE
+#endif
+
+// Define BOOST_FOREACH_LITE to get the lighter, standard-library-only
+// implementation in foreach_lite.hpp on compilers that support it.
+// BOOST_FOREACH_PROFILE, BOOST_FOREACH_AUDIT_COPIES and BOOST_FOREACH_MAX_COPY_SIZE
+// need the full one.
+#if defined(BOOST_FOREACH_LITE) && !defined(BOOST_FOREACH_LITE_UNSUPPORTED)                    \
+ && !defined(BOOST_FOREACH_NO_RANGE_BASED_FOR) && !defined(BOOST_FOREACH_PROFILE)              \
+ && !defined(BOOST_FOREACH_AUDIT_COPIES) && !defined(BOOST_FOREACH_MAX_COPY_SIZE)              \
+ && !defined(BOOST_FOREACH)
+# include <boost/foreach_lite.hpp>
+#endif
+
 #ifndef BOOST_FOREACH
 
 // MS compatible compilers support #pragma once
@@ -25,9 +42,19 @@
 #endif
 
 #include <cstddef>
+#include <climits>  // for CHAR_BIT
+#include <algorithm> // for std::copy
+#include <cstring>  // for std::strlen
+#include <string>   // for std::basic_string
+#include <vector>   // for std::vector
+#include <cwchar>   // for std::wcslen
 #include <utility>  // for std::pair
+#include <limits>   // for std::numeric_limits
+#include <iterator> // for std::random_access_iterator_tag
 
 #include <boost/config.hpp>
+#include <boost/version.hpp>
+#include <boost/assert.hpp>
 #include <boost/detail/workaround.hpp>
 
 // Define a compiler generic null pointer value
@@ -72,11 +99,103 @@
 # endif
 #endif
 
+// Compilers with range-based for and rvalue references can have BOOST_FOREACH
+// lowered to a native range-based for loop. Define BOOST_FOREACH_NO_RANGE_BASED_FOR
+// to force the classic expansion.
+#if !defined(BOOST_FOREACH_NO_RANGE_BASED_FOR)                                                  \
+ && (defined(BOOST_NO_CXX11_RANGE_BASED_FOR)                                                    \
+  || defined(BOOST_NO_CXX11_RVALUE_REFERENCES)                                                  \
+  || defined(BOOST_NO_CXX11_AUTO_DECLARATIONS)                                                  \
+  || defined(BOOST_NO_CXX11_DECLTYPE)                                                           \
+  || !defined(BOOST_FOREACH_COMPILE_TIME_CONST_RVALUE_DETECTION))
+# define BOOST_FOREACH_NO_RANGE_BASED_FOR
+#endif
+
+// Define BOOST_FOREACH_DEBUG_FAST to have the functions BOOST_FOREACH calls on
+// every iteration inlined even when the optimizer is off, leaving only the
+// calls to the iterator's own operators.
+#if defined(BOOST_FOREACH_DEBUG_FAST)
+# define BOOST_FOREACH_DEBUG_INLINE BOOST_FORCEINLINE
+#else
+# define BOOST_FOREACH_DEBUG_INLINE inline
+#endif
+
+// The functions BOOST_FOREACH calls are noexcept when the operations they
+// perform on the collection and its iterators are, so that a loop over
+// iterators that cannot throw needs no landing pads. Define
+// BOOST_FOREACH_NO_NOEXCEPT to leave the exception specifications off.
+#if defined(BOOST_NO_CXX11_NOEXCEPT) && !defined(BOOST_FOREACH_NO_NOEXCEPT)
+# define BOOST_FOREACH_NO_NOEXCEPT
+#endif
+
+#ifdef BOOST_FOREACH_NO_NOEXCEPT
+# define BOOST_FOREACH_NOEXCEPT
+# define BOOST_FOREACH_NOEXCEPT_IF(Predicate)
+#else
+# define BOOST_FOREACH_NOEXCEPT noexcept
+# define BOOST_FOREACH_NOEXCEPT_IF(Predicate) noexcept((Predicate))
+#endif
+
+// BOOST_FOREACH_UNROLLED fully unrolls loops over arrays, boost::array and
+// std::array of at most this many elements. It must be an integer literal.
+#ifndef BOOST_FOREACH_UNROLL_THRESHOLD
+# define BOOST_FOREACH_UNROLL_THRESHOLD 16
+#endif
+
+// Asks the compiler to unroll the loop that follows K times. A loop with a
+// constant trip count of at most K is unrolled completely.
+#if defined(__clang__)
+# define BOOST_FOREACH_PRAGMA_UNROLL(K) _Pragma(BOOST_PP_STRINGIZE(unroll K))
+#elif defined(__INTEL_COMPILER)
+# define BOOST_FOREACH_PRAGMA_UNROLL(K) _Pragma(BOOST_PP_STRINGIZE(unroll(K)))
+#elif defined(__GNUC__) && (__GNUC__ >= 8)
+# define BOOST_FOREACH_PRAGMA_UNROLL(K) _Pragma(BOOST_PP_STRINGIZE(GCC unroll K))
+#else
+# define BOOST_FOREACH_PRAGMA_UNROLL(K)
+#endif
+
+// Hints that the cache line holding the object at address P will soon be read.
+#if defined(__GNUC__) || defined(__clang__)
+# define BOOST_FOREACH_PREFETCH_ADDRESS(P) __builtin_prefetch(P)
+#elif defined(BOOST_MSVC) && (defined(_M_IX86) || defined(_M_X64))
+# include <xmmintrin.h>
+# define BOOST_FOREACH_PREFETCH_ADDRESS(P) _mm_prefetch(static_cast<char const *>(P), _MM_HINT_T0)
+#else
+# define BOOST_FOREACH_PREFETCH_ADDRESS(P) static_cast<void>(P)
+#endif
+
+// Define BOOST_FOREACH_LIBRARY_SEGMENTS to have BOOST_FOREACH iterate over
+// boost::circular_buffer, and over std::deque and std::vector<bool> with
+// libstdc++, a block at a time. It reads the private members of their
+// iterators, so each library is only adapted in the versions whose layout it
+// was checked against; elsewhere, and by default, they are iterated an element
+// at a time.
+#if defined(BOOST_FOREACH_LIBRARY_SEGMENTS)
+# if (BOOST_VERSION >= 103500) && (BOOST_VERSION < 109000)
+#  define BOOST_FOREACH_CIRCULAR_BUFFER_SEGMENTS
+# endif
+# if defined(_GLIBCXX_RELEASE) && (_GLIBCXX_RELEASE >= 7) && (_GLIBCXX_RELEASE <= 15)          \
+  && !defined(_GLIBCXX_DEBUG) && !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_SFINAE_EXPR)
+#  define BOOST_FOREACH_LIBSTDCXX_SEGMENTS
+# endif
+#endif
+
 #include <boost/mpl/if.hpp>
 #include <boost/mpl/assert.hpp>
 #include <boost/mpl/logical.hpp>
 #include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/has_xxx.hpp>
+#include <boost/mpl/size_t.hpp>
 #include <boost/noncopyable.hpp>
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/stringize.hpp>
+#include <boost/preprocessor/control/iif.hpp>
+#include <boost/preprocessor/arithmetic/dec.hpp>
+#include <boost/preprocessor/comparison/equal.hpp>
+#include <boost/preprocessor/seq/size.hpp>
+#include <boost/preprocessor/seq/for_each_i.hpp>
+#include <boost/preprocessor/tuple/elem.hpp>
 #include <boost/range/end.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/rend.hpp>
@@ -85,27 +204,80 @@
 #include <boost/range/reverse_iterator.hpp>
 #include <boost/type_traits/is_array.hpp>
 #include <boost/type_traits/is_const.hpp>
+#include <boost/type_traits/is_convertible.hpp>
 #include <boost/type_traits/is_abstract.hpp>
 #include <boost/type_traits/is_base_and_derived.hpp>
 #include <boost/type_traits/is_rvalue_reference.hpp>
+#include <boost/type_traits/is_reference.hpp>
+#include <boost/type_traits/is_lvalue_reference.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_signed.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/promote.hpp>
+#include <boost/type_traits/make_signed.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
+#include <boost/type_traits/declval.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_pointer.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/type_traits/remove_reference.hpp>
 #include <boost/iterator/iterator_traits.hpp>
+#include <boost/iterator/iterator_categories.hpp>
 #include <boost/utility/addressof.hpp>
+#include <boost/utility/enable_if.hpp>
 #include <boost/foreach_fwd.hpp>
 
-#ifdef BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION
-# include <new>
-# include <boost/aligned_storage.hpp>
-# include <boost/utility/enable_if.hpp>
-# include <boost/type_traits/remove_const.hpp>
+#include <new>
+#include <boost/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/is_pod.hpp>
+#include <boost/type_traits/is_pointer.hpp>
+#if !defined(BOOST_NO_CXX11_HDR_ARRAY)
+# include <array>
 #endif
 
 namespace boost
 {
 
+// forward declarations for array
+template<typename T, std::size_t N>
+class array;
+
+// forward declarations for container::vector and container::small_vector
+namespace container
+{
+    template<typename T, typename Allocator, typename Options>
+    class vector;
+
+    template<typename T, std::size_t N, typename Allocator, typename Options>
+    class small_vector;
+}
+
 // forward declarations for iterator_range
 template<typename T>
 class iterator_range;
 
+#ifdef BOOST_FOREACH_CIRCULAR_BUFFER_SEGMENTS
+// forward declarations for circular_buffer
+namespace cb_details
+{
+    template<typename Buff, typename Traits>
+    struct iterator;
+}
+#endif
+
+namespace foreach_detail_
+{
+    template<typename T>
+    struct has_contiguous_storage_;
+
+    template<typename T>
+    struct has_sentinel_;
+
+    template<typename Iter>
+    struct segmented_iterator_;
+}
+
 // forward declarations for sub_range
 template<typename T>
 class sub_range;
@@ -131,6 +303,35 @@ namespace foreach
     {
     };
 
+    ///////////////////////////////////////////////////////////////////////////////
+    // boost::foreach::is_contiguous
+    //   Specialize this for user-defined collection types whose elements are
+    //   stored contiguously, in order, so BOOST_FOREACH can iterate over them with
+    //   pointers. Only the standard and Boost contiguous containers, and, under
+    //   C++20, collections whose iterators model std::contiguous_iterator, are
+    //   detected by default.
+    template<typename T>
+    struct is_contiguous
+      : foreach_detail_::has_contiguous_storage_<T>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // boost::foreach::has_sentinel
+    //   True for collection types whose end() member returns a sentinel: an object
+    //   of another type than begin()'s, that the iterator can be compared with but
+    //   that need not be an iterator itself, like the end of a C++20 range. For
+    //   these, BOOST_FOREACH gets the iterator from begin() and the sentinel from
+    //   end(), and never computes an end iterator. Such collections are detected
+    //   by default, when end() returns a type that has no iterator_category, is
+    //   not a pointer, and compares with begin()'s; specialize this as true or
+    //   false to say otherwise.
+    template<typename T>
+    struct has_sentinel
+      : foreach_detail_::has_sentinel_<T>
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     // boost::foreach::is_noncopyable
     //   Specialize this for user-defined collection types if they cannot be copied.
@@ -152,6 +353,296 @@ namespace foreach
     {
     };
 
+    ///////////////////////////////////////////////////////////////////////////////
+    // boost::foreach::chunk
+    //   A pointer and a length: one block of elements from BOOST_FOREACH_CHUNK.
+    //   A chunk of a non-const contiguous collection is a chunk<T>, and refers
+    //   to the collection's own elements; other chunks are chunk<T const>.
+    template<typename T>
+    struct chunk
+    {
+        typedef T value_type;
+        typedef T *pointer;
+        typedef T &reference;
+        typedef T *iterator;
+        typedef T *const_iterator;
+        typedef std::size_t size_type;
+
+        chunk()
+          : data_(0)
+          , size_(0)
+        {
+        }
+
+        chunk(T *data, std::size_t size)
+          : data_(data)
+          , size_(size)
+        {
+        }
+
+        template<typename U>
+        chunk(chunk<U> const &that, BOOST_DEDUCED_TYPENAME enable_if<is_convertible<U *, T *> >::type * = 0)
+          : data_(that.data())
+          , size_(that.size())
+        {
+        }
+
+        T *data() const { return this->data_; }
+        std::size_t size() const { return this->size_; }
+        bool empty() const { return 0 == this->size_; }
+        T *begin() const { return this->data_; }
+        T *end() const { return this->data_ + this->size_; }
+        T &operator [](std::size_t i) const { return this->data_[i]; }
+
+    private:
+        T *data_;
+        std::size_t size_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // boost::foreach::integer_range
+    //   The integers from first up to but not including last, step apart, from
+    //   irange(). The iterators hold the integer itself, and the end iterator
+    //   the one a step past the last, worked out up front, so that
+    //   BOOST_FOREACH becomes an integer loop whose trip count the compiler
+    //   knows. That integer must be representable in T; it always is when step
+    //   is 1 or -1.
+    template<typename T>
+    struct integer_range
+    {
+        // **** READ THIS IF YOUR COMPILE BREAKS HERE ****
+        //
+        // irange() counts with the built-in integer types, other than bool.
+        BOOST_MPL_ASSERT_MSG(
+            (is_integral<T>::value && !is_same<T, bool>::value)
+          , IRANGE_NEEDS_AN_INTEGER_TYPE
+          , (T)
+        );
+
+        // unsigned, and at least as wide as int, so that the arithmetic wraps
+        // rather than overflows
+        typedef BOOST_DEDUCED_TYPENAME make_unsigned<BOOST_DEDUCED_TYPENAME promote<T>::type>::type size_type;
+        typedef BOOST_DEDUCED_TYPENAME make_signed<size_type>::type difference_type;
+        typedef T value_type;
+
+        struct iterator
+        {
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef BOOST_DEDUCED_TYPENAME integer_range::difference_type difference_type;
+            typedef T const *pointer;
+            typedef T reference;
+
+            iterator()
+              : cur_(0)
+              , step_(1)
+            {
+            }
+
+            iterator(T cur, T step)
+              : cur_(cur)
+              , step_(step)
+            {
+            }
+
+            T operator *() const
+            {
+                return this->cur_;
+            }
+
+            T operator [](difference_type d) const
+            {
+                return *(*this + d);
+            }
+
+            iterator &operator ++() { this->cur_ += this->step_; return *this; }
+            iterator operator ++(int) { iterator tmp(*this); ++*this; return tmp; }
+            iterator &operator --() { this->cur_ -= this->step_; return *this; }
+            iterator operator --(int) { iterator tmp(*this); --*this; return tmp; }
+
+            iterator &operator +=(difference_type d)
+            {
+                this->cur_ = static_cast<T>(static_cast<size_type>(this->cur_) + static_cast<size_type>(d) * static_cast<size_type>(this->step_));
+                return *this;
+            }
+
+            iterator &operator -=(difference_type d)
+            {
+                return *this += -d;
+            }
+
+            friend iterator operator +(iterator it, difference_type d) { return it += d; }
+            friend iterator operator +(difference_type d, iterator it) { return it += d; }
+            friend iterator operator -(iterator it, difference_type d) { return it -= d; }
+
+            friend difference_type operator -(iterator const &left, iterator const &right)
+            {
+                return static_cast<difference_type>(static_cast<size_type>(left.cur_) - static_cast<size_type>(right.cur_))
+                     / static_cast<difference_type>(left.step_);
+            }
+
+            friend bool operator ==(iterator const &left, iterator const &right) { return left.cur_ == right.cur_; }
+            friend bool operator !=(iterator const &left, iterator const &right) { return left.cur_ != right.cur_; }
+            friend bool operator <(iterator const &left, iterator const &right) { return 0 < right - left; }
+            friend bool operator >(iterator const &left, iterator const &right) { return right < left; }
+            friend bool operator <=(iterator const &left, iterator const &right) { return !(right < left); }
+            friend bool operator >=(iterator const &left, iterator const &right) { return !(left < right); }
+
+        private:
+            T cur_;
+            T step_;
+        };
+
+        typedef iterator const_iterator;
+
+        integer_range(T first, T last, T step = 1)
+          : first_(first)
+          , last_(first)
+          , step_(step)
+        {
+            BOOST_ASSERT(0 != step);
+            size_type const size = integer_range::count(first, last, step, is_signed<T>());
+            BOOST_ASSERT(0 == size || integer_range::fits(first, step, size, is_signed<T>()));
+            // counting one at a time ends at last itself, which the compiler sees
+            // without the division in count()
+            if(1 == step)
+                this->last_ = first < last ? last : first;
+            else if(is_signed<T>::value && 1 == 0u - static_cast<size_type>(step))
+                this->last_ = last < first ? last : first;
+            else
+                this->last_ = *(this->begin() + static_cast<difference_type>(size));
+        }
+
+        size_type size() const { return integer_range::distance(this->first_, this->last_, this->step_, is_signed<T>()); }
+        bool empty() const { return this->first_ == this->last_; }
+        iterator begin() const { return iterator(this->first_, this->step_); }
+        iterator end() const { return iterator(this->last_, this->step_); }
+        T operator [](size_type n) const { return this->begin()[static_cast<difference_type>(n)]; }
+
+    private:
+        static size_type count(T first, T last, T step, mpl::true_)
+        {
+            if(step < 0)
+            {
+                return last < first
+                  ? static_cast<size_type>((static_cast<size_type>(first) - static_cast<size_type>(last) - 1u) / (0u - static_cast<size_type>(step)) + 1u)
+                  : 0u;
+            }
+            return integer_range::count(first, last, step, mpl::false_());
+        }
+
+        static size_type count(T first, T last, T step, mpl::false_)
+        {
+            return first < last
+              ? static_cast<size_type>((static_cast<size_type>(last) - static_cast<size_type>(first) - 1u) / static_cast<size_type>(step) + 1u)
+              : 0u;
+        }
+
+        // the number of steps from one integer to another it reaches
+        static size_type distance(T from, T to, T step, mpl::true_)
+        {
+            return step < 0
+              ? static_cast<size_type>((static_cast<size_type>(from) - static_cast<size_type>(to)) / (0u - static_cast<size_type>(step)))
+              : integer_range::distance(from, to, step, mpl::false_());
+        }
+
+        static size_type distance(T from, T to, T step, mpl::false_)
+        {
+            return static_cast<size_type>((static_cast<size_type>(to) - static_cast<size_type>(from)) / static_cast<size_type>(step));
+        }
+
+        // whether the integer a step past the last of size is representable
+        static bool fits(T first, T step, size_type size, mpl::true_)
+        {
+            T const back = static_cast<T>(static_cast<size_type>(first) + (size - 1u) * static_cast<size_type>(step));
+            return step < 0
+              ? 0u - static_cast<size_type>(step) <= static_cast<size_type>(back) - static_cast<size_type>((std::numeric_limits<T>::min)())
+              : integer_range::fits(first, step, size, mpl::false_());
+        }
+
+        static bool fits(T first, T step, size_type size, mpl::false_)
+        {
+            T const back = static_cast<T>(static_cast<size_type>(first) + (size - 1u) * static_cast<size_type>(step));
+            return static_cast<size_type>(step) <= static_cast<size_type>((std::numeric_limits<T>::max)()) - static_cast<size_type>(back);
+        }
+
+        T first_;
+        T last_;
+        T step_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // irange
+    //   irange(first, last) counts up from first to last - 1. irange(first, last, step)
+    //   counts from first in steps of step, which must not be 0, for as long as it
+    //   has not reached or passed last: up if step is positive, and down if negative.
+    //   Use BOOST_REVERSE_FOREACH to count down from last - 1 to first.
+    template<typename T>
+    inline integer_range<T> irange(T first, T last)
+    {
+        return integer_range<T>(first, last);
+    }
+
+    template<typename T>
+    inline integer_range<T> irange(T first, T last, T step)
+    {
+        return integer_range<T>(first, last, step);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // boost::foreach::segmented_iterator
+    //   Specialize this for the random-access iterators of user-defined collections
+    //   that store their elements in a sequence of contiguous blocks, like a deque.
+    //   The specialization derives from mpl::true_ and has a static member
+    //
+    //     chunk<E> segment(Iter const &cur, Iter const &end);
+    //
+    //   where E is the type *cur refers to, that returns the longest non-empty run
+    //   of contiguous elements starting at cur and ending at or before end.
+    //   BOOST_FOREACH then iterates over each block with a pointer. If the elements
+    //   are not addressable, like the bits of a word, the specialization instead
+    //   names as its nested block type what segment() returns: a type with
+    //   begin(), end() and size() members, whose iterators are what BOOST_FOREACH
+    //   iterates over the block with. With BOOST_FOREACH_LIBRARY_SEGMENTS, the
+    //   iterators of boost::circular_buffer, and of std::deque and
+    //   std::vector<bool> with libstdc++, are segmented.
+    template<typename Iter>
+    struct segmented_iterator
+      : foreach_detail_::segmented_iterator_<Iter>
+    {
+    };
+
+#ifdef BOOST_FOREACH_CIRCULAR_BUFFER_SEGMENTS
+
+    // A circular_buffer holds its elements in at most two blocks: array_one(),
+    // then array_two().
+    template<typename Buff, typename Traits>
+    struct segmented_iterator<cb_details::iterator<Buff, Traits> >
+      : boost::mpl::true_
+    {
+        typedef cb_details::iterator<Buff, Traits> iterator;
+        typedef BOOST_DEDUCED_TYPENAME boost::remove_reference<
+            BOOST_DEDUCED_TYPENAME Traits::reference
+        >::type element;
+
+        static chunk<element> segment(iterator const &cur, iterator const &end)
+        {
+            BOOST_DEDUCED_TYPENAME Buff::const_array_range const one = cur.m_buff->array_one();
+            BOOST_DEDUCED_TYPENAME Buff::const_array_range const two = cur.m_buff->array_two();
+            element *const first = boost::addressof(*cur);
+            BOOST_DEDUCED_TYPENAME Buff::const_pointer last =
+                one.first <= first && first < one.first + one.second
+                  ? one.first + one.second
+                  : two.first + two.second;
+            // end.m_it is 0 at the end of the buffer; otherwise end is in cur's
+            // block if it is not behind cur
+            if(0 != end.m_it && first <= end.m_it && end.m_it < last)
+                last = end.m_it;
+            return chunk<element>(first, static_cast<std::size_t>(last - first));
+        }
+    };
+#endif
+
 } // namespace foreach
 
 } // namespace boost
@@ -188,6 +679,14 @@ template<typename T>
 inline boost::mpl::true_ *
 boost_foreach_is_lightweight_proxy(T **&, boost::foreach::tag) { return 0; }
 
+template<typename T>
+inline boost::mpl::true_ *
+boost_foreach_is_lightweight_proxy(boost::foreach::chunk<T> *&, boost::foreach::tag) { return 0; }
+
+template<typename T>
+inline boost::mpl::true_ *
+boost_foreach_is_lightweight_proxy(boost::foreach::integer_range<T> *&, boost::foreach::tag) { return 0; }
+
 ///////////////////////////////////////////////////////////////////////////////
 // boost_foreach_is_noncopyable
 //   Another customization point for the is_noncopyable trait,
@@ -250,7 +749,7 @@ struct auto_any_base
 {
     // auto_any_base must evaluate to false in boolean context so that
     // they can be declared in if() statements.
-    operator bool() const
+    BOOST_FOREACH_DEBUG_INLINE operator bool() const BOOST_FOREACH_NOEXCEPT
     {
         return false;
     }
@@ -259,11 +758,25 @@ struct auto_any_base
 template<typename T>
 struct auto_any : auto_any_base
 {
-    explicit auto_any(T const &t)
+    explicit auto_any(T const &t) BOOST_FOREACH_NOEXCEPT_IF(noexcept(T(boost::declval<T const &>())))
       : item(t)
     {
     }
 
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    explicit auto_any(T &&t) BOOST_FOREACH_NOEXCEPT_IF(noexcept(T(boost::declval<T>())))
+      : item(static_cast<T &&>(t))
+    {
+    }
+#endif
+
+    // constructs the item in place, so that it need not be copied
+    template<typename A0, typename A1>
+    auto_any(A0 const &a0, A1 const &a1) BOOST_FOREACH_NOEXCEPT_IF(noexcept(T(a0, a1)))
+      : item(a0, a1)
+    {
+    }
+
     // temporaries of type auto_any will be bound to const auto_any_base
     // references, but we still want to be able to mutate the stored
     // data, so declare it as mutable.
@@ -273,7 +786,7 @@ struct auto_any : auto_any_base
 typedef auto_any_base const &auto_any_t;
 
 template<typename T, typename C>
-inline BOOST_DEDUCED_TYPENAME boost::mpl::if_<C, T const, T>::type &auto_any_cast(auto_any_t a)
+BOOST_FOREACH_DEBUG_INLINE BOOST_DEDUCED_TYPENAME boost::mpl::if_<C, T const, T>::type &auto_any_cast(auto_any_t a) BOOST_FOREACH_NOEXCEPT
 {
     return static_cast<auto_any<T> const &>(a).item;
 }
@@ -327,6 +840,32 @@ struct wrap_cstr<wchar_t const *>
     typedef wchar_t const *const_iterator;
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// cstr_end
+//   Find the terminator of a null-terminated string up front, so that the loop
+//   runs over a bounded pointer range that the optimizer can vectorize. The
+//   standard library's strlen and wcslen are already vectorized on all the
+//   major platforms.
+inline char *cstr_end(char *p) BOOST_FOREACH_NOEXCEPT
+{
+    return p + std::strlen(p);
+}
+
+inline char const *cstr_end(char const *p) BOOST_FOREACH_NOEXCEPT
+{
+    return p + std::strlen(p);
+}
+
+inline wchar_t *cstr_end(wchar_t *p) BOOST_FOREACH_NOEXCEPT
+{
+    return p + std::wcslen(p);
+}
+
+inline wchar_t const *cstr_end(wchar_t const *p) BOOST_FOREACH_NOEXCEPT
+{
+    return p + std::wcslen(p);
+}
+
 template<typename T>
 struct is_char_array
   : mpl::and_<
@@ -338,560 +877,2696 @@ struct is_char_array
     >
 {};
 
-template<typename T, typename C = boost::mpl::false_>
-struct foreach_iterator
+template<typename Iter>
+struct is_random_access_
+  : is_convertible<
+        BOOST_DEDUCED_TYPENAME iterator_traversal<Iter>::type
+      , random_access_traversal_tag
+    >
 {
-    // **** READ THIS IF YOUR COMPILE BREAKS HERE ****
-    //
-    // There is an ambiguity about how to iterate over arrays of char and wchar_t. 
-    // Should the last array element be treated as a null terminator to be skipped, or
-    // is it just like any other element in the array? To fix the problem, you must
-    // say which behavior you want.
-    //
-    // To treat the container as a null-terminated string, merely cast it to a
-    // char const *, as in BOOST_FOREACH( char ch, (char const *)"hello" ) ...
-    //
-    // To treat the container as an array, use boost::as_array() in <boost/range/as_array.hpp>,
-    // as in BOOST_FOREACH( char ch, boost::as_array("hello") ) ...
-    BOOST_MPL_ASSERT_MSG( (!is_char_array<T>::value), IS_THIS_AN_ARRAY_OR_A_NULL_TERMINATED_STRING, (T&) );
+};
 
-    // If the type is a pointer to a null terminated string (as opposed 
-    // to an array type), there is no ambiguity.
-    typedef BOOST_DEDUCED_TYPENAME wrap_cstr<T>::type container;
+///////////////////////////////////////////////////////////////////////////////
+// has_contiguous_storage_
+//   The default for is_contiguous: true only for the collections known to keep
+//   their elements contiguously, in order -- std::vector (but not
+//   std::vector<bool>), std::basic_string, std::array, boost::array,
+//   boost::container::vector and boost::container::small_vector -- and, where
+//   the standard library has concepts, for those whose iterators model
+//   std::contiguous_iterator. A data() member proves nothing: a strided view
+//   can have one, and random-access iterators that refer to its elements.
+template<typename T>
+struct is_known_contiguous_
+  : boost::mpl::false_
+{
+};
 
-    typedef BOOST_DEDUCED_TYPENAME boost::mpl::eval_if<
-        C
-      , range_const_iterator<container>
-      , range_mutable_iterator<container>
-    >::type type;
+template<typename T, typename A>
+struct is_known_contiguous_<std::vector<T, A> >
+  : boost::mpl::true_
+{
 };
 
+template<typename A>
+struct is_known_contiguous_<std::vector<bool, A> >
+  : boost::mpl::false_
+{
+};
 
-template<typename T, typename C = boost::mpl::false_>
-struct foreach_reverse_iterator
+template<typename Char, typename Traits, typename A>
+struct is_known_contiguous_<std::basic_string<Char, Traits, A> >
+  : boost::mpl::true_
 {
-    // **** READ THIS IF YOUR COMPILE BREAKS HERE ****
-    //
-    // There is an ambiguity about how to iterate over arrays of char and wchar_t. 
-    // Should the last array element be treated as a null terminator to be skipped, or
-    // is it just like any other element in the array? To fix the problem, you must
-    // say which behavior you want.
-    //
-    // To treat the container as a null-terminated string, merely cast it to a
-    // char const *, as in BOOST_FOREACH( char ch, (char const *)"hello" ) ...
-    //
-    // To treat the container as an array, use boost::as_array() in <boost/range/as_array.hpp>,
-    // as in BOOST_FOREACH( char ch, boost::as_array("hello") ) ...
-    BOOST_MPL_ASSERT_MSG( (!is_char_array<T>::value), IS_THIS_AN_ARRAY_OR_A_NULL_TERMINATED_STRING, (T&) );
+};
 
-    // If the type is a pointer to a null terminated string (as opposed 
-    // to an array type), there is no ambiguity.
-    typedef BOOST_DEDUCED_TYPENAME wrap_cstr<T>::type container;
+#if !defined(BOOST_NO_CXX11_HDR_ARRAY)
+template<typename T, std::size_t N>
+struct is_known_contiguous_<std::array<T, N> >
+  : boost::mpl::true_
+{
+};
+#endif
 
-    typedef BOOST_DEDUCED_TYPENAME boost::mpl::eval_if<
-        C
-      , range_reverse_iterator<container const>
-      , range_reverse_iterator<container>
-    >::type type;
+template<typename T, std::size_t N>
+struct is_known_contiguous_<boost::array<T, N> >
+  : boost::mpl::true_
+{
 };
 
-template<typename T, typename C = boost::mpl::false_>
-struct foreach_reference
-  : iterator_reference<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>
+template<typename T, typename A, typename Options>
+struct is_known_contiguous_<container::vector<T, A, Options> >
+  : boost::mpl::true_
 {
 };
 
-///////////////////////////////////////////////////////////////////////////////
-// encode_type
-//
-template<typename T>
-inline type2type<T> *encode_type(T &, boost::false_type*) { return 0; }
+template<typename T, std::size_t N, typename A, typename Options>
+struct is_known_contiguous_<container::small_vector<T, N, A, Options> >
+  : boost::mpl::true_
+{
+};
 
+#if defined(__cpp_lib_concepts)
 template<typename T>
-inline type2type<T, const_> *encode_type(T const &, boost::true_type*) { return 0; }
+struct has_contiguous_storage_
+  : boost::mpl::bool_<
+        is_known_contiguous_<T>::value
+     || std::contiguous_iterator<BOOST_DEDUCED_TYPENAME range_const_iterator<T>::type>
+    >
+{
+};
+#else
+template<typename T>
+struct has_contiguous_storage_
+  : is_known_contiguous_<T>
+{
+};
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// has_sentinel_
+//   The default for has_sentinel: a collection has a sentinel if its end()
+//   member returns a type that is not begin()'s, is not an iterator itself,
+//   and can be compared with begin()'s. An end() that returns an iterator of
+//   another type, like a const_iterator, is not a sentinel. member_iterator_
+//   and member_sentinel_ get those types from a collection that may be const.
+#if !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_SFINAE_EXPR)
+template<typename End>
+boost::mpl::true_ *iterator_test_(BOOST_DEDUCED_TYPENAME End::iterator_category *);
+
+template<typename End>
+boost::mpl::bool_<boost::is_pointer<End>::value> *iterator_test_(...);
 
 template<typename T>
-inline type2type<T> *encode_type(T &, boost::mpl::false_*) { return 0; }
+boost::mpl::bool_<
+    !boost::is_same<
+        decltype(boost::declval<T &>().begin())
+      , decltype(boost::declval<T &>().end())
+    >::value
+ && !boost::remove_pointer<
+        decltype(iterator_test_<BOOST_DEDUCED_TYPENAME boost::remove_cv<
+            BOOST_DEDUCED_TYPENAME boost::remove_reference<decltype(boost::declval<T &>().end())>::type
+        >::type>(0))
+    >::type::value
+> *sentinel_test_(int, decltype(static_cast<bool>(boost::declval<T &>().begin() == boost::declval<T &>().end())) * = 0);
 
 template<typename T>
-inline type2type<T, const_> *encode_type(T const &, boost::mpl::true_*) { return 0; }
+boost::mpl::false_ *sentinel_test_(...);
 
-///////////////////////////////////////////////////////////////////////////////
-// set_false
-//
-inline bool set_false(bool &b)
+template<typename T>
+struct has_sentinel_
+  : boost::remove_pointer<decltype(sentinel_test_<T>(0))>::type
 {
-    b = false;
-    return false;
-}
+};
 
-///////////////////////////////////////////////////////////////////////////////
-// to_ptr
-//
 template<typename T>
-inline T *&to_ptr(T const &)
+struct member_iterator_
 {
-    static T *t = 0;
-    return t;
-}
+    typedef decltype(boost::declval<T &>().begin()) type;
+};
 
-// Borland needs a little extra help with arrays
-#if BOOST_WORKAROUND(BOOST_BORLANDC, BOOST_TESTED_AT(0x564))
-template<typename T,std::size_t N>
-inline T (*&to_ptr(T (&)[N]))[N]
+template<typename T>
+struct member_sentinel_
 {
-    static T (*t)[N] = 0;
-    return t;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// derefof
-//
+    typedef decltype(boost::declval<T &>().end()) type;
+};
+#else
 template<typename T>
-inline T &derefof(T *t)
+struct has_sentinel_
+  : boost::mpl::false_
 {
-    // This is a work-around for a compiler bug in Borland. If T* is a pointer to array type U(*)[N],
-    // then dereferencing it results in a U* instead of U(&)[N]. The cast forces the issue.
-    return reinterpret_cast<T &>(
-        *const_cast<char *>(
-            reinterpret_cast<char const volatile *>(t)
-        )
-    );
-}
+};
 
-# define BOOST_FOREACH_DEREFOF(T) boost::foreach_detail_::derefof(*T)
-#else
-# define BOOST_FOREACH_DEREFOF(T) (*T)
+template<typename T>
+struct member_sentinel_;
 #endif
 
-#if defined(BOOST_FOREACH_COMPILE_TIME_CONST_RVALUE_DETECTION)                                  \
- && !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
-///////////////////////////////////////////////////////////////////////////////
-// Rvalue references makes it drop-dead simple to detect at compile time
-// whether an expression is an rvalue.
 ///////////////////////////////////////////////////////////////////////////////
+// segmented_iterator_
+//   The default for segmented_iterator. With BOOST_FOREACH_LIBSTDCXX_SEGMENTS,
+//   the iterators of libstdc++'s std::deque are detected by their members:
+//   _M_cur and _M_last bound the rest of the block _M_node points to. Those of
+//   its std::vector<bool> are detected by _M_p, the word they point into, and
+//   _M_offset, the bit; each word is a block, walked with a mask. Otherwise no
+//   iterator is segmented unless segmented_iterator is specialized for it.
+#ifdef BOOST_FOREACH_LIBSTDCXX_SEGMENTS
+template<typename Iter>
+boost::mpl::true_ *bit_iterator_test_(
+    decltype(boost::declval<Iter const &>()._M_p) *
+  , decltype(boost::declval<Iter const &>()._M_offset) *);
+
+template<typename Iter>
+boost::mpl::false_ *bit_iterator_test_(...);
+
+// One bit of a word: a reference to it, or its value for a const iterator.
+template<typename Reference>
+struct bit_reference_
+{
+    template<typename Word>
+    static BOOST_FOREACH_DEBUG_INLINE Reference get(Word *p, Word mask) BOOST_FOREACH_NOEXCEPT_IF(noexcept(Reference(p, mask)))
+    {
+        return Reference(p, mask);
+    }
+};
 
-# define BOOST_FOREACH_IS_RVALUE(COL)                                                           \
-    boost::foreach_detail_::is_rvalue_((COL), 0)
+template<>
+struct bit_reference_<bool>
+{
+    template<typename Word>
+    static BOOST_FOREACH_DEBUG_INLINE bool get(Word *p, Word mask) BOOST_FOREACH_NOEXCEPT
+    {
+        return 0 != (*p & mask);
+    }
+};
 
-#elif defined(BOOST_FOREACH_COMPILE_TIME_CONST_RVALUE_DETECTION)                                \
- && defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
-///////////////////////////////////////////////////////////////////////////////
-// Detect at compile-time whether an expression yields an rvalue or
-// an lvalue. This is rather non-standard, but some popular compilers
+template<typename Word, typename Reference>
+struct bit_cursor
+{
+    bit_cursor() BOOST_FOREACH_NOEXCEPT
+      : p(0)
+      , mask(0)
+    {
+    }
+
+    bit_cursor(Word *p, Word mask) BOOST_FOREACH_NOEXCEPT
+      : p(p)
+      , mask(mask)
+    {
+    }
+
+    BOOST_FOREACH_DEBUG_INLINE Reference operator *() const
+        BOOST_FOREACH_NOEXCEPT_IF(noexcept(bit_reference_<Reference>::get(this->p, this->mask)))
+    {
+        return bit_reference_<Reference>::get(this->p, this->mask);
+    }
+
+    BOOST_FOREACH_DEBUG_INLINE bit_cursor &operator ++() BOOST_FOREACH_NOEXCEPT
+    {
+        this->mask <<= 1;
+        return *this;
+    }
+
+    BOOST_FOREACH_DEBUG_INLINE bool operator ==(bit_cursor const &that) const BOOST_FOREACH_NOEXCEPT
+    {
+        return this->mask == that.mask;
+    }
+
+    BOOST_FOREACH_DEBUG_INLINE bool operator !=(bit_cursor const &that) const BOOST_FOREACH_NOEXCEPT
+    {
+        return this->mask != that.mask;
+    }
+
+private:
+    Word *p;
+    Word mask;
+};
+
+// The bits [first, last) of a word. The mask of the cursor past the top bit is 0.
+template<typename Word, typename Reference>
+struct bit_block
+{
+    typedef bit_cursor<Word, Reference> iterator;
+
+    bit_block(Word *p, std::size_t first, std::size_t last)
+      : p(p)
+      , first(first)
+      , last(last)
+    {
+    }
+
+    iterator begin() const
+    {
+        return iterator(this->p, Word(1) << this->first);
+    }
+
+    iterator end() const
+    {
+        return iterator(this->p, this->last == sizeof(Word) * CHAR_BIT ? Word(0) : Word(1) << this->last);
+    }
+
+    std::size_t size() const
+    {
+        return this->last - this->first;
+    }
+
+private:
+    Word *p;
+    std::size_t first;
+    std::size_t last;
+};
+
+template<
+    typename Iter
+  , typename IsBits = BOOST_DEDUCED_TYPENAME boost::remove_pointer<decltype(bit_iterator_test_<Iter>(0, 0))>::type
+>
+struct bit_segments_
+  : boost::mpl::false_
+{
+};
+
+template<typename Iter>
+struct bit_segments_<Iter, boost::mpl::true_>
+  : boost::mpl::true_
+{
+    typedef BOOST_DEDUCED_TYPENAME boost::remove_pointer<decltype(boost::declval<Iter const &>()._M_p)>::type word;
+    typedef bit_block<word, BOOST_DEDUCED_TYPENAME iterator_reference<Iter>::type> block;
+
+    static block segment(Iter const &cur, Iter const &end)
+    {
+        return block(cur._M_p, cur._M_offset, cur._M_p == end._M_p ? end._M_offset : sizeof(word) * CHAR_BIT);
+    }
+};
+
+template<typename Iter>
+boost::mpl::true_ *deque_iterator_test_(
+    decltype(boost::declval<Iter const &>()._M_cur) *
+  , decltype(boost::declval<Iter const &>()._M_last) *
+  , decltype(boost::declval<Iter const &>()._M_node) *);
+
+template<typename Iter>
+boost::mpl::false_ *deque_iterator_test_(...);
+
+template<
+    typename Iter
+  , typename IsDeque = BOOST_DEDUCED_TYPENAME boost::remove_pointer<decltype(deque_iterator_test_<Iter>(0, 0, 0))>::type
+>
+struct deque_segments_
+  : bit_segments_<Iter>
+{
+};
+
+template<typename Iter>
+struct deque_segments_<Iter, boost::mpl::true_>
+  : boost::mpl::true_
+{
+    typedef BOOST_DEDUCED_TYPENAME boost::remove_reference<
+        BOOST_DEDUCED_TYPENAME iterator_reference<Iter>::type
+    >::type element;
+
+    static boost::foreach::chunk<element> segment(Iter const &cur, Iter const &end)
+    {
+        return boost::foreach::chunk<element>(
+            cur._M_cur
+          , static_cast<std::size_t>((cur._M_node == end._M_node ? end._M_cur : cur._M_last) - cur._M_cur));
+    }
+};
+
+template<typename Iter>
+struct segmented_iterator_
+  : deque_segments_<Iter>
+{
+};
+#else
+template<typename Iter>
+struct segmented_iterator_
+  : boost::mpl::false_
+{
+};
+#endif
+
+template<typename Iter>
+struct contiguous_pointer_
+{
+    typedef BOOST_DEDUCED_TYPENAME boost::remove_reference<
+        BOOST_DEDUCED_TYPENAME iterator_reference<Iter>::type
+    >::type *type;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// segment_block_
+//   What segmented_iterator<Iter>::segment() returns: its nested block type,
+//   or else a chunk of the elements Iter refers to.
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(has_block_type_, block, false)
+
+template<typename Iter, bool HasBlock = has_block_type_<boost::foreach::segmented_iterator<Iter> >::value>
+struct segment_block_
+{
+    typedef boost::foreach::chunk<
+        BOOST_DEDUCED_TYPENAME boost::remove_pointer<BOOST_DEDUCED_TYPENAME contiguous_pointer_<Iter>::type>::type
+    > type;
+};
+
+template<typename Iter>
+struct segment_block_<Iter, true>
+{
+    typedef BOOST_DEDUCED_TYPENAME boost::foreach::segmented_iterator<Iter>::block type;
+};
+
+template<typename T, typename C = boost::mpl::false_>
+struct foreach_iterator
+{
+    // **** READ THIS IF YOUR COMPILE BREAKS HERE ****
+    //
+    // There is an ambiguity about how to iterate over arrays of char and wchar_t. 
+    // Should the last array element be treated as a null terminator to be skipped, or
+    // is it just like any other element in the array? To fix the problem, you must
+    // say which behavior you want.
+    //
+    // To treat the container as a null-terminated string, merely cast it to a
+    // char const *, as in BOOST_FOREACH( char ch, (char const *)"hello" ) ...
+    //
+    // To treat the container as an array, use boost::as_array() in <boost/range/as_array.hpp>,
+    // as in BOOST_FOREACH( char ch, boost::as_array("hello") ) ...
+    BOOST_MPL_ASSERT_MSG( (!is_char_array<T>::value), IS_THIS_AN_ARRAY_OR_A_NULL_TERMINATED_STRING, (T&) );
+
+    // If the type is a pointer to a null terminated string (as opposed 
+    // to an array type), there is no ambiguity.
+    typedef BOOST_DEDUCED_TYPENAME wrap_cstr<T>::type container;
+
+    // Collections with a sentinel are iterated with their own begin() and end(),
+    // not Boost.Range's, which would want the end to be an iterator.
+#if !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_SFINAE_EXPR)
+    typedef boost::mpl::bool_<boost::foreach::has_sentinel<container>::value> has_sentinel;
+
+    typedef BOOST_DEDUCED_TYPENAME boost::mpl::eval_if<
+        has_sentinel
+      , member_iterator_<BOOST_DEDUCED_TYPENAME type2type<container, C>::type>
+      , boost::mpl::eval_if<
+            C
+          , range_const_iterator<container>
+          , range_mutable_iterator<container>
+        >
+    >::type range_iterator;
+#else
+    typedef boost::mpl::false_ has_sentinel;
+
+    typedef BOOST_DEDUCED_TYPENAME boost::mpl::eval_if<
+        C
+      , range_const_iterator<container>
+      , range_mutable_iterator<container>
+    >::type range_iterator;
+#endif
+
+    // Contiguous collections are iterated with pointers, which keeps checked
+    // and debug iterators out of the loop.
+#ifdef BOOST_FOREACH_NO_CONTIGUOUS
+    typedef boost::mpl::false_ contiguous;
+#else
+    typedef boost::mpl::bool_<boost::mpl::and_<
+        boost::mpl::not_<has_sentinel>
+      , boost::foreach::is_contiguous<container>
+    >::value> contiguous;
+#endif
+
+    typedef BOOST_DEDUCED_TYPENAME boost::mpl::eval_if<
+        contiguous
+      , contiguous_pointer_<range_iterator>
+      , boost::mpl::identity<range_iterator>
+    >::type type;
+
+    // Collections stored in a sequence of contiguous blocks are iterated with
+    // pointers, a block at a time.
+#ifdef BOOST_FOREACH_NO_SEGMENTED
+    typedef boost::mpl::false_ segmented;
+#else
+    typedef boost::mpl::bool_<boost::mpl::and_<
+        boost::mpl::not_<has_sentinel>
+      , boost::mpl::not_<contiguous>
+      , boost::foreach::segmented_iterator<type>
+    >::value> segmented;
+#endif
+
+    // the type of end(), which is the iterator type but for collections with a sentinel
+    typedef BOOST_DEDUCED_TYPENAME boost::mpl::eval_if<
+        has_sentinel
+      , member_sentinel_<BOOST_DEDUCED_TYPENAME type2type<container, C>::type>
+      , boost::mpl::identity<type>
+    >::type sentinel;
+};
+
+
+template<typename T, typename C = boost::mpl::false_>
+struct foreach_reverse_iterator
+{
+    // **** READ THIS IF YOUR COMPILE BREAKS HERE ****
+    //
+    // There is an ambiguity about how to iterate over arrays of char and wchar_t. 
+    // Should the last array element be treated as a null terminator to be skipped, or
+    // is it just like any other element in the array? To fix the problem, you must
+    // say which behavior you want.
+    //
+    // To treat the container as a null-terminated string, merely cast it to a
+    // char const *, as in BOOST_FOREACH( char ch, (char const *)"hello" ) ...
+    //
+    // To treat the container as an array, use boost::as_array() in <boost/range/as_array.hpp>,
+    // as in BOOST_FOREACH( char ch, boost::as_array("hello") ) ...
+    BOOST_MPL_ASSERT_MSG( (!is_char_array<T>::value), IS_THIS_AN_ARRAY_OR_A_NULL_TERMINATED_STRING, (T&) );
+
+    // A collection whose end is a sentinel cannot be iterated backwards from it.
+    BOOST_MPL_ASSERT_MSG( (!foreach_iterator<T, C>::has_sentinel::value), BOOST_REVERSE_FOREACH_NEEDS_AN_END_ITERATOR, (T&) );
+
+    // If the type is a pointer to a null terminated string (as opposed 
+    // to an array type), there is no ambiguity.
+    typedef BOOST_DEDUCED_TYPENAME wrap_cstr<T>::type container;
+
+    typedef BOOST_DEDUCED_TYPENAME boost::mpl::eval_if<
+        BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::contiguous
+      , boost::mpl::identity<reverse_iterator<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type> >
+      , boost::mpl::eval_if<
+            C
+          , range_reverse_iterator<container const>
+          , range_reverse_iterator<container>
+        >
+    >::type type;
+};
+
+template<typename T, typename C = boost::mpl::false_>
+struct foreach_reference
+  : iterator_reference<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>
+{
+};
+
+#ifndef BOOST_FOREACH_NO_NOEXCEPT
+///////////////////////////////////////////////////////////////////////////////
+// nothrow_iterator_
+//   Whether testing an iterator for the end, incrementing it and dereferencing
+//   it can throw, as the functions that do it on every iteration ask.
+template<
+    typename Iter
+  , typename Sentinel = Iter
+  , typename Reference = decltype(*boost::declval<Iter &>())
+>
+struct nothrow_iterator_
+{
+    static bool const done = noexcept(static_cast<bool>(boost::declval<Iter &>() == boost::declval<Sentinel &>()));
+    static bool const next = noexcept(++boost::declval<Iter &>());
+    static bool const deref = noexcept(static_cast<Reference>(*boost::declval<Iter &>()));
+};
+
+template<typename T, typename C>
+struct nothrow_iteration_
+  : nothrow_iterator_<
+        BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type
+      , BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::sentinel
+      , BOOST_DEDUCED_TYPENAME foreach_reference<T, C>::type
+    >
+{
+};
+
+template<typename T, typename C>
+struct nothrow_reverse_iteration_
+  : nothrow_iterator_<
+        BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type
+      , BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type
+      , BOOST_DEDUCED_TYPENAME foreach_reference<T, C>::type
+    >
+{
+};
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// bounded_iterator_
+//   The iterator type of a collection whose end is an iterator too. The loops
+//   that measure the distance to the end, or that step towards it other than
+//   one element at a time, cannot use a sentinel.
+template<typename T, typename C>
+struct bounded_iterator_
+{
+    BOOST_MPL_ASSERT_MSG( (!foreach_iterator<T, C>::has_sentinel::value), THIS_LOOP_NEEDS_AN_END_ITERATOR_NOT_A_SENTINEL, (T&) );
+
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type type;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// iterators_
+//   Gets the iterators of foreach_iterator and foreach_reverse_iterator from
+//   a collection. The pointers into a contiguous collection are computed once,
+//   each from one call to its own begin and end. A collection with a sentinel has its begin()
+//   and end() called as they are.
+template<typename Pointer>
+struct to_pointer_
+{
+    static Pointer get(Pointer begin, Pointer) BOOST_FOREACH_NOEXCEPT
+    {
+        return begin;
+    }
+
+    template<typename Iter>
+    static Pointer get(Iter begin, Iter end)
+        BOOST_FOREACH_NOEXCEPT_IF(noexcept(begin == end ? Pointer() : boost::addressof(*begin)))
+    {
+        return begin == end ? Pointer() : boost::addressof(*begin);
+    }
+
+    static Pointer get_end(Pointer, Pointer end) BOOST_FOREACH_NOEXCEPT
+    {
+        return end;
+    }
+
+    template<typename Iter>
+    static Pointer get_end(Iter begin, Iter end)
+        BOOST_FOREACH_NOEXCEPT_IF(noexcept(begin == end ? Pointer() : boost::addressof(*begin) + (end - begin)))
+    {
+        return begin == end ? Pointer() : boost::addressof(*begin) + (end - begin);
+    }
+};
+
+template<
+    typename T
+  , typename C
+  , typename Contiguous = BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::contiguous
+  , typename Sentinel = BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::has_sentinel
+>
+struct iterators_
+{
+    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iterator;
+    typedef BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type reverse_iterator;
+
+    static iterator begin(type &col) BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterator(boost::begin(col))))
+    {
+        return iterator(boost::begin(col));
+    }
+
+    static iterator end(type &col) BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterator(boost::end(col))))
+    {
+        return iterator(boost::end(col));
+    }
+
+    static reverse_iterator rbegin(type &col) BOOST_FOREACH_NOEXCEPT_IF(noexcept(reverse_iterator(boost::rbegin(col))))
+    {
+        return reverse_iterator(boost::rbegin(col));
+    }
+
+    static reverse_iterator rend(type &col) BOOST_FOREACH_NOEXCEPT_IF(noexcept(reverse_iterator(boost::rend(col))))
+    {
+        return reverse_iterator(boost::rend(col));
+    }
+};
+
+template<typename T, typename C>
+struct iterators_<T, C, boost::mpl::true_, boost::mpl::false_>
+{
+    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iterator;
+    typedef BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type reverse_iterator;
+
+    static iterator begin(type &col)
+        BOOST_FOREACH_NOEXCEPT_IF(noexcept(to_pointer_<iterator>::get(boost::begin(col), boost::end(col))))
+    {
+        return to_pointer_<iterator>::get(boost::begin(col), boost::end(col));
+    }
+
+    static iterator end(type &col)
+        BOOST_FOREACH_NOEXCEPT_IF(noexcept(to_pointer_<iterator>::get_end(boost::begin(col), boost::end(col))))
+    {
+        return to_pointer_<iterator>::get_end(boost::begin(col), boost::end(col));
+    }
+
+    static reverse_iterator rbegin(type &col) BOOST_FOREACH_NOEXCEPT_IF(noexcept(reverse_iterator(iterators_::end(col))))
+    {
+        return reverse_iterator(iterators_::end(col));
+    }
+
+    static reverse_iterator rend(type &col) BOOST_FOREACH_NOEXCEPT_IF(noexcept(reverse_iterator(iterators_::begin(col))))
+    {
+        return reverse_iterator(iterators_::begin(col));
+    }
+};
+
+template<typename T, typename C>
+struct iterators_<T, C, boost::mpl::false_, boost::mpl::true_>
+{
+    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iterator;
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::sentinel sentinel;
+
+    static iterator begin(type &col) BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterator(col.begin())))
+    {
+        return col.begin();
+    }
+
+    static sentinel end(type &col) BOOST_FOREACH_NOEXCEPT_IF(noexcept(sentinel(col.end())))
+    {
+        return col.end();
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// encode_type
+//
+template<typename T>
+inline type2type<T> *encode_type(T &, boost::false_type*) { return 0; }
+
+template<typename T>
+inline type2type<T, const_> *encode_type(T const &, boost::true_type*) { return 0; }
+
+template<typename T>
+inline type2type<T> *encode_type(T &, boost::mpl::false_*) { return 0; }
+
+template<typename T>
+inline type2type<T, const_> *encode_type(T const &, boost::mpl::true_*) { return 0; }
+
+///////////////////////////////////////////////////////////////////////////////
+// set_false
+//
+BOOST_FOREACH_DEBUG_INLINE bool set_false(bool &b) BOOST_FOREACH_NOEXCEPT
+{
+    b = false;
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// to_ptr
+//
+template<typename T>
+inline T *&to_ptr(T const &)
+{
+    static T *t = 0;
+    return t;
+}
+
+// Borland needs a little extra help with arrays
+#if BOOST_WORKAROUND(BOOST_BORLANDC, BOOST_TESTED_AT(0x564))
+template<typename T,std::size_t N>
+inline T (*&to_ptr(T (&)[N]))[N]
+{
+    static T (*t)[N] = 0;
+    return t;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// derefof
+//
+template<typename T>
+inline T &derefof(T *t)
+{
+    // This is a work-around for a compiler bug in Borland. If T* is a pointer to array type U(*)[N],
+    // then dereferencing it results in a U* instead of U(&)[N]. The cast forces the issue.
+    return reinterpret_cast<T &>(
+        *const_cast<char *>(
+            reinterpret_cast<char const volatile *>(t)
+        )
+    );
+}
+
+# define BOOST_FOREACH_DEREFOF(T) boost::foreach_detail_::derefof(*T)
+#else
+# define BOOST_FOREACH_DEREFOF(T) (*T)
+#endif
+
+#if defined(BOOST_FOREACH_COMPILE_TIME_CONST_RVALUE_DETECTION)                                  \
+ && !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+///////////////////////////////////////////////////////////////////////////////
+// Rvalue references makes it drop-dead simple to detect at compile time
+// whether an expression is an rvalue.
+///////////////////////////////////////////////////////////////////////////////
+
+# define BOOST_FOREACH_IS_RVALUE(COL)                                                           \
+    boost::foreach_detail_::is_rvalue_((COL), 0)
+
+#elif defined(BOOST_FOREACH_COMPILE_TIME_CONST_RVALUE_DETECTION)                                \
+ && defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+///////////////////////////////////////////////////////////////////////////////
+// Detect at compile-time whether an expression yields an rvalue or
+// an lvalue. This is rather non-standard, but some popular compilers
 // accept it.
 ///////////////////////////////////////////////////////////////////////////////
 
 ///////////////////////////////////////////////////////////////////////////////
-// rvalue_probe
+// rvalue_probe
+//
+template<typename T>
+struct rvalue_probe
+{
+    struct private_type_ {};
+    // can't ever return an array by value
+    typedef BOOST_DEDUCED_TYPENAME boost::mpl::if_<
+        boost::mpl::or_<boost::is_abstract<T>, boost::is_array<T> >, private_type_, T
+    >::type value_type;
+    operator value_type() { return *reinterpret_cast<value_type *>(this); } // never called
+    operator T &() const { return *reinterpret_cast<T *>(const_cast<rvalue_probe *>(this)); } // never called
+};
+
+template<typename T>
+rvalue_probe<T> const make_probe(T const &)
+{
+    return rvalue_probe<T>();
+}
+
+# define BOOST_FOREACH_IS_RVALUE(COL)                                                           \
+    boost::foreach_detail_::and_(                                                               \
+        boost::foreach_detail_::not_(boost::foreach_detail_::is_array_(COL))                    \
+      , (true ? 0 : boost::foreach_detail_::is_rvalue_(                                         \
+            (true ? boost::foreach_detail_::make_probe(COL) : (COL)), 0)))
+
+#elif defined(BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION)
+///////////////////////////////////////////////////////////////////////////////
+// Detect at run-time whether an expression yields an rvalue
+// or an lvalue. This is 100% standard C++, but not all compilers
+// accept it. Also, it causes FOREACH to break when used with non-
+// copyable collection types.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// rvalue_probe
+//
+template<typename T>
+struct rvalue_probe
+{
+    rvalue_probe(T &t, bool &b)
+      : value(t)
+      , is_rvalue(b)
+    {
+    }
+
+    struct private_type_ {};
+    // can't ever return an array or an abstract type by value
+    #ifdef BOOST_NO_IS_ABSTRACT
+    typedef BOOST_DEDUCED_TYPENAME boost::mpl::if_<
+        boost::is_array<T>, private_type_, T
+    >::type value_type;
+    #else
+    typedef BOOST_DEDUCED_TYPENAME boost::mpl::if_<
+        boost::mpl::or_<boost::is_abstract<T>, boost::is_array<T> >, private_type_, T
+    >::type value_type;
+    #endif
+    
+    operator value_type()
+    {
+        this->is_rvalue = true;
+        return this->value;
+    }
+
+    operator T &() const
+    {
+        return this->value;
+    }
+
+private:
+    T &value;
+    bool &is_rvalue;
+};
+
+template<typename T>
+rvalue_probe<T> make_probe(T &t, bool &b) { return rvalue_probe<T>(t, b); }
+
+template<typename T>
+rvalue_probe<T const> make_probe(T const &t, bool &b)  { return rvalue_probe<T const>(t, b); }
+
+///////////////////////////////////////////////////////////////////////////////
+// simple_variant
+//  holds either a T or a T const*
+template<typename T>
+struct simple_variant
+{
+    simple_variant(T const *t) BOOST_FOREACH_NOEXCEPT
+      : is_rvalue(false)
+    {
+        *static_cast<T const **>(this->data.address()) = t;
+    }
+
+    simple_variant(T const &t) BOOST_FOREACH_NOEXCEPT_IF(noexcept(T(boost::declval<T const &>())))
+      : is_rvalue(true)
+    {
+        ::new(this->data.address()) T(t);
+    }
+
+    // copies t only if it is an rvalue
+    simple_variant(T const &t, bool rvalue) BOOST_FOREACH_NOEXCEPT_IF(noexcept(T(boost::declval<T const &>())))
+      : is_rvalue(rvalue)
+    {
+        if(this->is_rvalue)
+            ::new(this->data.address()) T(t);
+        else
+            *static_cast<T const **>(this->data.address()) = &t;
+    }
+
+    simple_variant(simple_variant const &that) BOOST_FOREACH_NOEXCEPT_IF(noexcept(T(boost::declval<T const &>())))
+      : is_rvalue(that.is_rvalue)
+    {
+        if(this->is_rvalue)
+            ::new(this->data.address()) T(*that.get());
+        else
+            *static_cast<T const **>(this->data.address()) = that.get();
+    }
+
+    ~simple_variant()
+    {
+        if(this->is_rvalue)
+            this->get()->~T();
+    }
+
+    T const *get() const BOOST_FOREACH_NOEXCEPT
+    {
+        if(this->is_rvalue)
+            return static_cast<T const *>(this->data.address());
+        else
+            return *static_cast<T const * const *>(this->data.address());
+    }
+
+private:
+    enum size_type { size = sizeof(T) > sizeof(T*) ? sizeof(T) : sizeof(T*) };
+    simple_variant &operator =(simple_variant const &); 
+    bool const is_rvalue;
+    aligned_storage<size> data;
+};
+
+// If the collection is an array or is noncopyable, it must be an lvalue.
+// If the collection is a lightweight proxy, treat it as an rvalue
+// BUGBUG what about a noncopyable proxy?
+template<typename LValue, typename IsProxy>
+inline BOOST_DEDUCED_TYPENAME boost::enable_if<boost::mpl::or_<LValue, IsProxy>, IsProxy>::type *
+should_copy_impl(LValue *, IsProxy *, bool *)
+{
+    return 0;
+}
+
+// Otherwise, we must determine at runtime whether it's an lvalue or rvalue
+inline bool *
+should_copy_impl(boost::mpl::false_ *, boost::mpl::false_ *, bool *is_rvalue)
+{
+    return is_rvalue;
+}
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// contain
+//
+#ifdef BOOST_NO_CXX11_RVALUE_REFERENCES
+template<typename T>
+inline auto_any<T> contain(T const &t, boost::mpl::true_ *) // rvalue
+    BOOST_FOREACH_NOEXCEPT_IF(noexcept(auto_any<T>(t)))
+{
+    return auto_any<T>(t);
+}
+#else
+// Non-const rvalues are moved into the loop's storage rather than copied
+template<typename T>
+inline auto_any<BOOST_DEDUCED_TYPENAME boost::remove_const<BOOST_DEDUCED_TYPENAME boost::remove_reference<T>::type>::type>
+contain(T &&t, boost::mpl::true_ *) // rvalue
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<BOOST_DEDUCED_TYPENAME boost::remove_const<
+        BOOST_DEDUCED_TYPENAME boost::remove_reference<T>::type>::type>(std::forward<T>(t)))))
+{
+    typedef BOOST_DEDUCED_TYPENAME boost::remove_const<BOOST_DEDUCED_TYPENAME boost::remove_reference<T>::type>::type type;
+    return auto_any<type>(std::forward<T>(t));
+}
+#endif
+
+template<typename T>
+inline auto_any<T *> contain(T &t, boost::mpl::false_ *) // lvalue
+    BOOST_FOREACH_NOEXCEPT
+{
+    // Cannot seem to get sunpro to handle addressof() with array types.
+    #if BOOST_WORKAROUND(__SUNPRO_CC, BOOST_TESTED_AT(0x570))
+    return auto_any<T *>(&t);
+    #else
+    return auto_any<T *>(boost::addressof(t));
+    #endif
+}
+
+#ifdef BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION
+template<typename T>
+inline auto_any<simple_variant<T> >
+contain(T const &t, bool *rvalue)
+    BOOST_FOREACH_NOEXCEPT_IF(noexcept(auto_any<simple_variant<T> >(t, *rvalue)))
+{
+    return auto_any<simple_variant<T> >(t, *rvalue);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// check_copy
+//   With BOOST_FOREACH_MAX_COPY_SIZE defined, a collection that is copied (or
+//   moved) into the loop because it is an rvalue must be no larger than that
+//   many bytes. Lightweight proxies are exempt, and so are collections whose
+//   rvalue-ness is only known at run time.
+template<typename T, typename C>
+inline bool check_copy(type2type<T, C> *, boost::mpl::true_ *, boost::mpl::false_ *) // rvalue
+{
+#ifdef BOOST_FOREACH_MAX_COPY_SIZE
+    BOOST_MPL_ASSERT_MSG( (sizeof(T) <= (BOOST_FOREACH_MAX_COPY_SIZE)),
+        BOOST_FOREACH_WOULD_COPY_A_COLLECTION_LARGER_THAN_BOOST_FOREACH_MAX_COPY_SIZE, (T) );
+#endif
+    return false;
+}
+
+template<typename T, typename C>
+inline bool check_copy(type2type<T, C> *, boost::mpl::true_ *, boost::mpl::true_ *) // proxy
+{
+    return false;
+}
+
+template<typename T, typename C, typename IsProxy>
+inline bool check_copy(type2type<T, C> *, boost::mpl::false_ *, IsProxy *) // lvalue
+{
+    return false;
+}
+
+template<typename T, typename C, typename IsProxy>
+inline bool check_copy(type2type<T, C> *, bool *, IsProxy *) // rvalue-ness known at run time
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// begin
+//
+template<typename T, typename C>
+inline auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>
+begin(auto_any_t col, type2type<T, C> *, boost::mpl::true_ *) // rvalue
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>(
+        iterators_<T, C>::begin(auto_any_cast<T, C>(col))))))
+{
+    return auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>(
+        iterators_<T, C>::begin(auto_any_cast<T, C>(col)));
+}
+
+template<typename T, typename C>
+inline auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>
+begin(auto_any_t col, type2type<T, C> *, boost::mpl::false_ *) // lvalue
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>(
+        iterators_<T, C>::begin(BOOST_FOREACH_DEREFOF((auto_any_cast<BOOST_DEDUCED_TYPENAME type2type<T, C>::type *, boost::mpl::false_>(col))))))))
+{
+    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
+    return auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>(
+        iterators_<T, C>::begin(BOOST_FOREACH_DEREFOF((auto_any_cast<type *, boost::mpl::false_>(col)))));
+}
+
+#ifdef BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION
+template<typename T>
+inline auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, const_>::type>
+begin(auto_any_t col, type2type<T, const_> *, bool *)
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, const_>::type>(
+        iterators_<T, const_>::begin(*auto_any_cast<simple_variant<T>, boost::mpl::false_>(col).get())))))
+{
+    return auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, const_>::type>(
+        iterators_<T, const_>::begin(*auto_any_cast<simple_variant<T>, boost::mpl::false_>(col).get()));
+}
+#endif
+
+#ifndef BOOST_NO_FUNCTION_TEMPLATE_ORDERING
+template<typename T, typename C>
+inline auto_any<T *>
+begin(auto_any_t col, type2type<T *, C> *, boost::mpl::true_ *) // null-terminated C-style strings
+    BOOST_FOREACH_NOEXCEPT
+{
+    return auto_any<T *>(auto_any_cast<T *, boost::mpl::false_>(col));
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// end
+//
+template<typename T, typename C>
+inline auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::sentinel>
+end(auto_any_t col, type2type<T, C> *, boost::mpl::true_ *) // rvalue
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::sentinel>(
+        iterators_<T, C>::end(auto_any_cast<T, C>(col))))))
+{
+    return auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::sentinel>(
+        iterators_<T, C>::end(auto_any_cast<T, C>(col)));
+}
+
+template<typename T, typename C>
+inline auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::sentinel>
+end(auto_any_t col, type2type<T, C> *, boost::mpl::false_ *) // lvalue
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::sentinel>(
+        iterators_<T, C>::end(BOOST_FOREACH_DEREFOF((auto_any_cast<BOOST_DEDUCED_TYPENAME type2type<T, C>::type *, boost::mpl::false_>(col))))))))
+{
+    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
+    return auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::sentinel>(
+        iterators_<T, C>::end(BOOST_FOREACH_DEREFOF((auto_any_cast<type *, boost::mpl::false_>(col)))));
+}
+
+#ifdef BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION
+template<typename T>
+inline auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, const_>::sentinel>
+end(auto_any_t col, type2type<T, const_> *, bool *)
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, const_>::sentinel>(
+        iterators_<T, const_>::end(*auto_any_cast<simple_variant<T>, boost::mpl::false_>(col).get())))))
+{
+    return auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, const_>::sentinel>(
+        iterators_<T, const_>::end(*auto_any_cast<simple_variant<T>, boost::mpl::false_>(col).get()));
+}
+#endif
+
+#ifndef BOOST_NO_FUNCTION_TEMPLATE_ORDERING
+template<typename T, typename C>
+inline auto_any<T *>
+end(auto_any_t col, type2type<T *, C> *, boost::mpl::true_ *) // null-terminated C-style strings
+    BOOST_FOREACH_NOEXCEPT_IF(noexcept(cstr_end(auto_any_cast<T *, boost::mpl::false_>(col))))
+{
+    return auto_any<T *>(cstr_end(auto_any_cast<T *, boost::mpl::false_>(col)));
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// done
+//
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE bool done(auto_any_t cur, auto_any_t end, type2type<T, C> *)
+    BOOST_FOREACH_NOEXCEPT_IF((nothrow_iteration_<T, C>::done))
+{
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iter_t;
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::sentinel sentinel_t;
+    return auto_any_cast<iter_t, boost::mpl::false_>(cur) == auto_any_cast<sentinel_t, boost::mpl::false_>(end);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// next
+//
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE void next(auto_any_t cur, type2type<T, C> *)
+    BOOST_FOREACH_NOEXCEPT_IF((nothrow_iteration_<T, C>::next))
+{
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iter_t;
+    ++auto_any_cast<iter_t, boost::mpl::false_>(cur);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// deref
+//
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE BOOST_DEDUCED_TYPENAME foreach_reference<T, C>::type
+deref(auto_any_t cur, type2type<T, C> *)
+    BOOST_FOREACH_NOEXCEPT_IF((nothrow_iteration_<T, C>::deref))
+{
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iter_t;
+    return *auto_any_cast<iter_t, boost::mpl::false_>(cur);
+}
+
+#if defined(BOOST_FOREACH_COMPILE_TIME_CONST_RVALUE_DETECTION)                                \
+ && !defined(BOOST_NO_CXX11_RVALUE_REFERENCES) && !defined(BOOST_NO_CXX11_DECLTYPE)
+///////////////////////////////////////////////////////////////////////////////
+// should_consume
+//   Whether BOOST_FOREACH_CONSUME may move the elements out of the collection:
+//   only if the loop owns it, because it is a non-const rvalue, and only if
+//   the elements are the collection's own, as a container's are. A container
+//   makes its elements const when it is const, and yields them by lvalue
+//   reference; a view or a lightweight proxy, whose elements are another's,
+//   does not. Ref is the type of the collection expression.
+template<typename T, typename C, typename Ref>
+inline boost::mpl::bool_<
+    !boost::is_lvalue_reference<Ref>::value
+ && !boost::is_const<BOOST_DEDUCED_TYPENAME boost::remove_reference<Ref>::type>::value
+ && boost::is_lvalue_reference<BOOST_DEDUCED_TYPENAME foreach_reference<T, boost::mpl::false_>::type>::value
+ && !boost::is_same<
+        BOOST_DEDUCED_TYPENAME foreach_reference<T, const_>::type
+      , BOOST_DEDUCED_TYPENAME foreach_reference<T, boost::mpl::false_>::type
+    >::value
+> *should_consume(type2type<T, C> *, boost::mpl::identity<Ref> *)
+{
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// consume_type
+//   Iterates over a collection the loop consumes with its mutable iterators.
+//   The collection is the loop's own mutable copy, so that is safe even though
+//   BOOST_FOREACH_TYPEOF calls it const.
+template<typename T, typename C>
+inline type2type<T, boost::mpl::false_> *consume_type(type2type<T, C> *, boost::mpl::true_ *)
+{
+    return 0;
+}
+
+template<typename T, typename C>
+inline type2type<T, C> *consume_type(type2type<T, C> *, boost::mpl::false_ *)
+{
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// consume
+//   The element as an rvalue, if the loop consumes the collection.
+template<typename U>
+BOOST_FOREACH_DEBUG_INLINE U &&consume(U &u, boost::mpl::true_ *) BOOST_FOREACH_NOEXCEPT
+{
+    return static_cast<U &&>(u);
+}
+
+template<typename U>
+BOOST_FOREACH_DEBUG_INLINE U &&consume(U &&u, boost::mpl::false_ *) BOOST_FOREACH_NOEXCEPT
+{
+    return static_cast<U &&>(u);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// segment_
+//   The position of BOOST_FOREACH within a block of a segmented collection.
+//   The block is taken from the iterator, which is moved past it up front, and
+//   is walked with a pointer, or with the iterator of the block type that the
+//   collection's segmented_iterator names. Other collections are a single
+//   block, walked with the iterator itself, as by done, next and deref; the
+//   loop over the blocks is then known at compile time to run once.
+template<typename Pointer>
+struct segment_state
+{
+    segment_state(Pointer first, Pointer last)
+      : first(first)
+      , last(last)
+    {
+    }
+
+    Pointer first;
+    Pointer last;
+};
+
+struct whole_collection
+{
+};
+
+template<typename T, typename C, typename Segmented = BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::segmented>
+struct segment_
+{
+    typedef whole_collection type;
+};
+
+template<typename T, typename C>
+struct segment_<T, C, boost::mpl::true_>
+{
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iter_t;
+    typedef BOOST_DEDUCED_TYPENAME segment_block_<iter_t>::type block;
+    typedef BOOST_DEDUCED_TYPENAME block::iterator pointer;
+    typedef segment_state<pointer> type;
+};
+
+template<typename T, typename C>
+inline segment_<T, C> *segment_type(type2type<T, C> *)
+{
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// segments_begin
+//   Whether there is a block to take. The whole of a collection that is not
+//   segmented is taken, even if it is empty.
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE bool segments_begin(auto_any_t, auto_any_t, segment_<T, C, boost::mpl::false_> *)
+    BOOST_FOREACH_NOEXCEPT
+{
+    return true;
+}
+
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE bool segments_begin(auto_any_t cur, auto_any_t end, segment_<T, C, boost::mpl::true_> *)
+    BOOST_FOREACH_NOEXCEPT_IF((nothrow_iteration_<T, C>::done))
+{
+    typedef BOOST_DEDUCED_TYPENAME segment_<T, C>::iter_t iter_t;
+    return !(auto_any_cast<iter_t, boost::mpl::false_>(cur) == auto_any_cast<iter_t, boost::mpl::false_>(end));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// segment
+//   Takes the next block, and notes in more whether another one follows it.
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE auto_any<whole_collection>
+segment(auto_any_t, auto_any_t, bool &more, segment_<T, C, boost::mpl::false_> *) BOOST_FOREACH_NOEXCEPT
+{
+    more = false;
+    return auto_any<whole_collection>(whole_collection());
+}
+
+template<typename T, typename C>
+inline auto_any<BOOST_DEDUCED_TYPENAME segment_<T, C>::type>
+segment(auto_any_t cur, auto_any_t end, bool &more, segment_<T, C, boost::mpl::true_> *)
+{
+    typedef BOOST_DEDUCED_TYPENAME segment_<T, C>::iter_t iter_t;
+    iter_t &it = auto_any_cast<iter_t, boost::mpl::false_>(cur);
+    iter_t const &last = auto_any_cast<iter_t, boost::mpl::false_>(end);
+    BOOST_DEDUCED_TYPENAME segment_<T, C>::block const block =
+        boost::foreach::segmented_iterator<iter_t>::segment(it, last);
+    it += static_cast<BOOST_DEDUCED_TYPENAME iterator_difference<iter_t>::type>(block.size());
+    more = !(it == last);
+    return auto_any<BOOST_DEDUCED_TYPENAME segment_<T, C>::type>(block.begin(), block.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// segment_done
+//
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE bool segment_done(auto_any_t cur, auto_any_t end, auto_any_t, segment_<T, C, boost::mpl::false_> *)
+    BOOST_FOREACH_NOEXCEPT_IF((nothrow_iteration_<T, C>::done))
+{
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iter_t;
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::sentinel sentinel_t;
+    return auto_any_cast<iter_t, boost::mpl::false_>(cur) == auto_any_cast<sentinel_t, boost::mpl::false_>(end);
+}
+
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE bool segment_done(auto_any_t, auto_any_t, auto_any_t seg, segment_<T, C, boost::mpl::true_> *)
+    BOOST_FOREACH_NOEXCEPT_IF((nothrow_iterator_<BOOST_DEDUCED_TYPENAME segment_<T, C>::pointer>::done))
+{
+    typedef BOOST_DEDUCED_TYPENAME segment_<T, C>::type state_t;
+    state_t const &state = auto_any_cast<state_t, boost::mpl::false_>(seg);
+    return state.first == state.last;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// segment_next
+//
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE void segment_next(auto_any_t cur, auto_any_t, segment_<T, C, boost::mpl::false_> *)
+    BOOST_FOREACH_NOEXCEPT_IF((nothrow_iteration_<T, C>::next))
+{
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iter_t;
+    ++auto_any_cast<iter_t, boost::mpl::false_>(cur);
+}
+
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE void segment_next(auto_any_t, auto_any_t seg, segment_<T, C, boost::mpl::true_> *)
+    BOOST_FOREACH_NOEXCEPT_IF((nothrow_iterator_<BOOST_DEDUCED_TYPENAME segment_<T, C>::pointer>::next))
+{
+    typedef BOOST_DEDUCED_TYPENAME segment_<T, C>::type state_t;
+    ++auto_any_cast<state_t, boost::mpl::false_>(seg).first;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// segment_deref
+//
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE BOOST_DEDUCED_TYPENAME foreach_reference<T, C>::type
+segment_deref(auto_any_t cur, auto_any_t, segment_<T, C, boost::mpl::false_> *)
+    BOOST_FOREACH_NOEXCEPT_IF((nothrow_iteration_<T, C>::deref))
+{
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iter_t;
+    return *auto_any_cast<iter_t, boost::mpl::false_>(cur);
+}
+
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE BOOST_DEDUCED_TYPENAME foreach_reference<T, C>::type
+segment_deref(auto_any_t, auto_any_t seg, segment_<T, C, boost::mpl::true_> *)
+    BOOST_FOREACH_NOEXCEPT_IF((nothrow_iterator_<
+        BOOST_DEDUCED_TYPENAME segment_<T, C>::pointer
+      , BOOST_DEDUCED_TYPENAME segment_<T, C>::pointer
+      , BOOST_DEDUCED_TYPENAME foreach_reference<T, C>::type
+    >::deref))
+{
+    typedef BOOST_DEDUCED_TYPENAME segment_<T, C>::type state_t;
+    return *auto_any_cast<state_t, boost::mpl::false_>(seg).first;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// rbegin
+//
+template<typename T, typename C>
+inline auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>
+rbegin(auto_any_t col, type2type<T, C> *, boost::mpl::true_ *) // rvalue
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>(
+        iterators_<T, C>::rbegin(auto_any_cast<T, C>(col))))))
+{
+    return auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>(
+        iterators_<T, C>::rbegin(auto_any_cast<T, C>(col)));
+}
+
+template<typename T, typename C>
+inline auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>
+rbegin(auto_any_t col, type2type<T, C> *, boost::mpl::false_ *) // lvalue
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>(
+        iterators_<T, C>::rbegin(BOOST_FOREACH_DEREFOF((auto_any_cast<BOOST_DEDUCED_TYPENAME type2type<T, C>::type *, boost::mpl::false_>(col))))))))
+{
+    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
+    return auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>(
+        iterators_<T, C>::rbegin(BOOST_FOREACH_DEREFOF((auto_any_cast<type *, boost::mpl::false_>(col)))));
+}
+
+#ifdef BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION
+template<typename T>
+inline auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, const_>::type>
+rbegin(auto_any_t col, type2type<T, const_> *, bool *)
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, const_>::type>(
+        iterators_<T, const_>::rbegin(*auto_any_cast<simple_variant<T>, boost::mpl::false_>(col).get())))))
+{
+    return auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, const_>::type>(
+        iterators_<T, const_>::rbegin(*auto_any_cast<simple_variant<T>, boost::mpl::false_>(col).get()));
+}
+#endif
+
+#ifndef BOOST_NO_FUNCTION_TEMPLATE_ORDERING
+template<typename T, typename C>
+inline auto_any<reverse_iterator<T *> >
+rbegin(auto_any_t col, type2type<T *, C> *, boost::mpl::true_ *) // null-terminated C-style strings
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<reverse_iterator<T *> >(
+        reverse_iterator<T *>(cstr_end(auto_any_cast<T *, boost::mpl::false_>(col)))))))
+{
+    return auto_any<reverse_iterator<T *> >(
+        reverse_iterator<T *>(cstr_end(auto_any_cast<T *, boost::mpl::false_>(col))));
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// rend
+//
+template<typename T, typename C>
+inline auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>
+rend(auto_any_t col, type2type<T, C> *, boost::mpl::true_ *) // rvalue
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>(
+        iterators_<T, C>::rend(auto_any_cast<T, C>(col))))))
+{
+    return auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>(
+        iterators_<T, C>::rend(auto_any_cast<T, C>(col)));
+}
+
+template<typename T, typename C>
+inline auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>
+rend(auto_any_t col, type2type<T, C> *, boost::mpl::false_ *) // lvalue
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>(
+        iterators_<T, C>::rend(BOOST_FOREACH_DEREFOF((auto_any_cast<BOOST_DEDUCED_TYPENAME type2type<T, C>::type *, boost::mpl::false_>(col))))))))
+{
+    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
+    return auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>(
+        iterators_<T, C>::rend(BOOST_FOREACH_DEREFOF((auto_any_cast<type *, boost::mpl::false_>(col)))));
+}
+
+#ifdef BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION
+template<typename T>
+inline auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, const_>::type>
+rend(auto_any_t col, type2type<T, const_> *, bool *)
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, const_>::type>(
+        iterators_<T, const_>::rend(*auto_any_cast<simple_variant<T>, boost::mpl::false_>(col).get())))))
+{
+    return auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, const_>::type>(
+        iterators_<T, const_>::rend(*auto_any_cast<simple_variant<T>, boost::mpl::false_>(col).get()));
+}
+#endif
+
+#ifndef BOOST_NO_FUNCTION_TEMPLATE_ORDERING
+template<typename T, typename C>
+inline auto_any<reverse_iterator<T *> >
+rend(auto_any_t col, type2type<T *, C> *, boost::mpl::true_ *) // null-terminated C-style strings
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(auto_any<reverse_iterator<T *> >(
+        reverse_iterator<T *>(auto_any_cast<T *, boost::mpl::false_>(col))))))
+{
+    return auto_any<reverse_iterator<T *> >(
+        reverse_iterator<T *>(auto_any_cast<T *, boost::mpl::false_>(col)));
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// rdone
+//
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE bool rdone(auto_any_t cur, auto_any_t end, type2type<T, C> *)
+    BOOST_FOREACH_NOEXCEPT_IF((nothrow_reverse_iteration_<T, C>::done))
+{
+    typedef BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type iter_t;
+    return auto_any_cast<iter_t, boost::mpl::false_>(cur) == auto_any_cast<iter_t, boost::mpl::false_>(end);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// rnext
+//
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE void rnext(auto_any_t cur, type2type<T, C> *)
+    BOOST_FOREACH_NOEXCEPT_IF((nothrow_reverse_iteration_<T, C>::next))
+{
+    typedef BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type iter_t;
+    ++auto_any_cast<iter_t, boost::mpl::false_>(cur);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// rderef
+//
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE BOOST_DEDUCED_TYPENAME foreach_reference<T, C>::type
+rderef(auto_any_t cur, type2type<T, C> *)
+    BOOST_FOREACH_NOEXCEPT_IF((nothrow_reverse_iteration_<T, C>::deref))
+{
+    typedef BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type iter_t;
+    return *auto_any_cast<iter_t, boost::mpl::false_>(cur);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// index_state
+//   The position of BOOST_FOREACH_INDEXED. A random-access collection is
+//   walked by the index alone, each element being found at begin + index, so
+//   the loop has a single induction variable and a trip count that is known
+//   up front. Other collections advance an iterator in step with the index.
+struct index_state
+{
+    index_state(std::size_t index, std::size_t size)
+      : index(index)
+      , size(size)
+    {
+    }
+
+    std::size_t index;
+    std::size_t size;
+};
+
+template<typename Iter, bool RandomAccess = is_random_access_<Iter>::value>
+struct indexed_
+{
+    static std::size_t size(Iter const &, Iter const &)
+    {
+        return 0;
+    }
+
+    static BOOST_FOREACH_DEBUG_INLINE bool done(index_state const &, Iter const &cur, Iter const &end)
+    {
+        return cur == end;
+    }
+
+    static BOOST_FOREACH_DEBUG_INLINE void next(index_state &idx, Iter &cur)
+    {
+        ++idx.index;
+        ++cur;
+    }
+
+    static BOOST_FOREACH_DEBUG_INLINE BOOST_DEDUCED_TYPENAME iterator_reference<Iter>::type
+    deref(index_state const &, Iter const &cur)
+    {
+        return *cur;
+    }
+};
+
+template<typename Iter>
+struct indexed_<Iter, true>
+{
+    typedef BOOST_DEDUCED_TYPENAME iterator_difference<Iter>::type difference_type;
+
+    static std::size_t size(Iter const &begin, Iter const &end)
+    {
+        return static_cast<std::size_t>(end - begin);
+    }
+
+    static BOOST_FOREACH_DEBUG_INLINE bool done(index_state const &idx, Iter const &, Iter const &)
+    {
+        return idx.index == idx.size;
+    }
+
+    static BOOST_FOREACH_DEBUG_INLINE void next(index_state &idx, Iter &)
+    {
+        ++idx.index;
+    }
+
+    // cur is never advanced; it stays at the beginning of the collection
+    static BOOST_FOREACH_DEBUG_INLINE BOOST_DEDUCED_TYPENAME iterator_reference<Iter>::type
+    deref(index_state const &idx, Iter const &cur)
+    {
+        return *(cur + static_cast<difference_type>(idx.index));
+    }
+};
+
+template<typename T, typename C>
+inline type2type<BOOST_DEDUCED_TYPENAME bounded_iterator_<T, C>::type> *
+iterator_type(type2type<T, C> *) { return 0; }
+
+template<typename T, typename C>
+inline type2type<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type> *
+reverse_iterator_type(type2type<T, C> *) { return 0; }
+
+///////////////////////////////////////////////////////////////////////////////
+// index_begin
+//
+template<typename Iter>
+inline auto_any<index_state> index_begin(auto_any_t cur, auto_any_t end, type2type<Iter> *)
+{
+    return auto_any<index_state>(0u, indexed_<Iter>::size(
+        auto_any_cast<Iter, boost::mpl::false_>(cur)
+      , auto_any_cast<Iter, boost::mpl::false_>(end)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// index_done
+//
+template<typename Iter>
+BOOST_FOREACH_DEBUG_INLINE bool index_done(auto_any_t idx, auto_any_t cur, auto_any_t end, type2type<Iter> *)
+{
+    return indexed_<Iter>::done(
+        auto_any_cast<index_state, boost::mpl::false_>(idx)
+      , auto_any_cast<Iter, boost::mpl::false_>(cur)
+      , auto_any_cast<Iter, boost::mpl::false_>(end));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// index_next
+//
+template<typename Iter>
+BOOST_FOREACH_DEBUG_INLINE void index_next(auto_any_t idx, auto_any_t cur, type2type<Iter> *)
+{
+    indexed_<Iter>::next(
+        auto_any_cast<index_state, boost::mpl::false_>(idx)
+      , auto_any_cast<Iter, boost::mpl::false_>(cur));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// index_deref
+//
+template<typename Iter>
+BOOST_FOREACH_DEBUG_INLINE BOOST_DEDUCED_TYPENAME iterator_reference<Iter>::type
+index_deref(auto_any_t idx, auto_any_t cur, type2type<Iter> *)
+{
+    return indexed_<Iter>::deref(
+        auto_any_cast<index_state, boost::mpl::false_>(idx)
+      , auto_any_cast<Iter, boost::mpl::false_>(cur));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// prefetcher_
+//   BOOST_FOREACH_PREFETCH keeps a second iterator some distance ahead of cur,
+//   and has the element it refers to brought into the cache, so that it is
+//   there by the time cur arrives. An element reached through a proxy has no
+//   address to prefetch.
+template<typename Iter, bool IsReference = is_reference<BOOST_DEDUCED_TYPENAME iterator_reference<Iter>::type>::value>
+struct prefetcher_
+{
+    static BOOST_FOREACH_DEBUG_INLINE void fetch(Iter const &)
+    {
+    }
+};
+
+template<typename Iter>
+struct prefetcher_<Iter, true>
+{
+    static BOOST_FOREACH_DEBUG_INLINE void fetch(Iter const &ahead)
+    {
+        BOOST_FOREACH_PREFETCH_ADDRESS(static_cast<void const *>(boost::addressof(*ahead)));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// prefetch_begin
+//
+template<typename Iter>
+inline auto_any<Iter> prefetch_begin(auto_any_t cur, auto_any_t end, std::size_t distance, type2type<Iter> *)
+{
+    // The iterator that runs ahead must not consume the elements cur is yet to visit.
+    BOOST_MPL_ASSERT_MSG(
+        (is_convertible<BOOST_DEDUCED_TYPENAME iterator_traversal<Iter>::type, forward_traversal_tag>::value)
+      , BOOST_FOREACH_PREFETCH_NEEDS_FORWARD_ITERATORS
+      , (Iter)
+    );
+
+    Iter ahead = auto_any_cast<Iter, boost::mpl::false_>(cur);
+    Iter const &last = auto_any_cast<Iter, boost::mpl::false_>(end);
+    for(; 0 != distance && !(ahead == last); --distance)
+        ++ahead;
+    if(!(ahead == last))
+        prefetcher_<Iter>::fetch(ahead);
+    return auto_any<Iter>(ahead);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// prefetch_next
+//   Advances ahead before prefetching, since advancing an iterator into a
+//   node-based container reads the node it leaves, not the one it arrives at.
+template<typename Iter>
+BOOST_FOREACH_DEBUG_INLINE void prefetch_next(auto_any_t ahead, auto_any_t end, type2type<Iter> *)
+{
+    Iter &next = auto_any_cast<Iter, boost::mpl::false_>(ahead);
+    Iter const &last = auto_any_cast<Iter, boost::mpl::false_>(end);
+    if(!(next == last) && !(++next == last))
+        prefetcher_<Iter>::fetch(next);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// zip_category
+//   The size of the array it returns is 1 for a random-access iterator and 2
+//   for any other, so that BOOST_FOREACH_ZIP can and the sizes together to find
+//   out, at compile time, whether all its collections are random-access.
+template<typename Iter>
+char (&zip_category(type2type<Iter> *))[is_random_access_<Iter>::value ? 1 : 2];
+
+///////////////////////////////////////////////////////////////////////////////
+// zip_begin
+//   When every collection is random-access, BOOST_FOREACH_ZIP counts the
+//   elements up to the length of the shortest collection, and finds each
+//   element at begin + index, as BOOST_FOREACH_INDEXED does. Otherwise the
+//   iterators are advanced together, and each is checked against its end.
+inline auto_any<index_state> zip_begin()
+{
+    return auto_any<index_state>(0u, static_cast<std::size_t>(-1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// zip_limit
+//
+template<typename Iter>
+inline bool zip_limit(auto_any_t zip, auto_any_t cur, auto_any_t end, type2type<Iter> *, boost::mpl::true_ *)
+{
+    index_state &state = auto_any_cast<index_state, boost::mpl::false_>(zip);
+    std::size_t const size = indexed_<Iter>::size(
+        auto_any_cast<Iter, boost::mpl::false_>(cur)
+      , auto_any_cast<Iter, boost::mpl::false_>(end));
+    if(size < state.size)
+        state.size = size;
+    return false;
+}
+
+template<typename Iter>
+inline bool zip_limit(auto_any_t, auto_any_t, auto_any_t, type2type<Iter> *, boost::mpl::false_ *)
+{
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// zip_done
+//
+BOOST_FOREACH_DEBUG_INLINE bool zip_done(auto_any_t zip, boost::mpl::true_ *)
+{
+    index_state const &state = auto_any_cast<index_state, boost::mpl::false_>(zip);
+    return state.index == state.size;
+}
+
+BOOST_FOREACH_DEBUG_INLINE bool zip_done(auto_any_t, boost::mpl::false_ *)
+{
+    return false;
+}
+
+template<typename Iter>
+BOOST_FOREACH_DEBUG_INLINE bool zip_at_end(auto_any_t, auto_any_t, type2type<Iter> *, boost::mpl::true_ *)
+{
+    return false;
+}
+
+template<typename Iter>
+BOOST_FOREACH_DEBUG_INLINE bool zip_at_end(auto_any_t cur, auto_any_t end, type2type<Iter> *, boost::mpl::false_ *)
+{
+    return auto_any_cast<Iter, boost::mpl::false_>(cur) == auto_any_cast<Iter, boost::mpl::false_>(end);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// zip_next
+//
+BOOST_FOREACH_DEBUG_INLINE void zip_next(auto_any_t zip, boost::mpl::true_ *)
+{
+    ++auto_any_cast<index_state, boost::mpl::false_>(zip).index;
+}
+
+BOOST_FOREACH_DEBUG_INLINE void zip_next(auto_any_t, boost::mpl::false_ *)
+{
+}
+
+template<typename Iter>
+BOOST_FOREACH_DEBUG_INLINE void zip_advance(auto_any_t, type2type<Iter> *, boost::mpl::true_ *)
+{
+}
+
+template<typename Iter>
+BOOST_FOREACH_DEBUG_INLINE void zip_advance(auto_any_t cur, type2type<Iter> *, boost::mpl::false_ *)
+{
+    ++auto_any_cast<Iter, boost::mpl::false_>(cur);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// zip_deref
+//
+template<typename Iter>
+BOOST_FOREACH_DEBUG_INLINE BOOST_DEDUCED_TYPENAME iterator_reference<Iter>::type
+zip_deref(auto_any_t zip, auto_any_t cur, type2type<Iter> *, boost::mpl::true_ *)
+{
+    typedef BOOST_DEDUCED_TYPENAME iterator_difference<Iter>::type difference_type;
+    return *(auto_any_cast<Iter, boost::mpl::false_>(cur)
+        + static_cast<difference_type>(auto_any_cast<index_state, boost::mpl::false_>(zip).index));
+}
+
+template<typename Iter>
+BOOST_FOREACH_DEBUG_INLINE BOOST_DEDUCED_TYPENAME iterator_reference<Iter>::type
+zip_deref(auto_any_t, auto_any_t cur, type2type<Iter> *, boost::mpl::false_ *)
+{
+    return *auto_any_cast<Iter, boost::mpl::false_>(cur);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// kv_
+//   BOOST_FOREACH_KV's key and value are references to the members of the pair
+//   the iterator refers to, and const if it is. Iterators that return pairs
+//   by value would leave references to their members dangling, so for them the
+//   key and value are returned by value.
+template<typename Ref, bool IsReference = is_reference<Ref>::value>
+struct kv_
+{
+    typedef BOOST_DEDUCED_TYPENAME remove_cv<Ref>::type pair_type;
+    typedef BOOST_DEDUCED_TYPENAME pair_type::first_type key_type;
+    typedef BOOST_DEDUCED_TYPENAME pair_type::second_type value_type;
+
+    static BOOST_FOREACH_DEBUG_INLINE key_type key(Ref pair)
+    {
+        return pair.first;
+    }
+
+    static BOOST_FOREACH_DEBUG_INLINE value_type value(Ref pair)
+    {
+        return pair.second;
+    }
+};
+
+template<typename Ref>
+struct kv_<Ref, true>
+{
+    typedef BOOST_DEDUCED_TYPENAME remove_reference<Ref>::type pair_type;
+    typedef BOOST_DEDUCED_TYPENAME boost::mpl::if_<
+        is_const<pair_type>
+      , BOOST_DEDUCED_TYPENAME pair_type::first_type const &
+      , BOOST_DEDUCED_TYPENAME pair_type::first_type &
+    >::type key_type;
+    typedef BOOST_DEDUCED_TYPENAME boost::mpl::if_<
+        is_const<pair_type>
+      , BOOST_DEDUCED_TYPENAME pair_type::second_type const &
+      , BOOST_DEDUCED_TYPENAME pair_type::second_type &
+    >::type value_type;
+
+    static BOOST_FOREACH_DEBUG_INLINE key_type key(pair_type &pair)
+    {
+        return pair.first;
+    }
+
+    static BOOST_FOREACH_DEBUG_INLINE value_type value(pair_type &pair)
+    {
+        return pair.second;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// kv_key
+//
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE BOOST_DEDUCED_TYPENAME kv_<BOOST_DEDUCED_TYPENAME foreach_reference<T, C>::type>::key_type
+kv_key(auto_any_t cur, type2type<T, C> *ty)
+{
+    return kv_<BOOST_DEDUCED_TYPENAME foreach_reference<T, C>::type>::key(deref(cur, ty));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// kv_value
+//
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE BOOST_DEDUCED_TYPENAME kv_<BOOST_DEDUCED_TYPENAME foreach_reference<T, C>::type>::value_type
+kv_value(auto_any_t cur, type2type<T, C> *ty)
+{
+    return kv_<BOOST_DEDUCED_TYPENAME foreach_reference<T, C>::type>::value(deref(cur, ty));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// index_value
+//
+BOOST_FOREACH_DEBUG_INLINE std::size_t index_value(auto_any_t idx)
+{
+    return auto_any_cast<index_state, boost::mpl::false_>(idx).index;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// chunk_buffer
+//   Room for N elements, constructed as they are gathered. The elements of
+//   one chunk are destroyed when the next is gathered, or with the buffer.
+template<typename T, std::size_t N>
+struct chunk_buffer
+{
+    chunk_buffer()
+      : size(0)
+    {
+    }
+
+    chunk_buffer(chunk_buffer const &that)
+      : size(0)
+    {
+        for(; this->size != that.size; ++this->size)
+            ::new(this->data() + this->size) T(that.data()[this->size]);
+    }
+
+    ~chunk_buffer()
+    {
+        this->clear();
+    }
+
+    T *data() { return static_cast<T *>(this->storage.address()); }
+    T const *data() const { return static_cast<T const *>(this->storage.address()); }
+
+    void clear()
+    {
+        for(; 0 != this->size; --this->size)
+            this->data()[this->size - 1].~T();
+    }
+
+    template<typename Iter>
+    void gather(Iter &cur, Iter const &end)
+    {
+        this->clear();
+        this->gather(cur, end, boost::mpl::bool_<is_random_access_<Iter>::value>());
+    }
+
+    template<typename Iter>
+    void gather(Iter &cur, Iter const &end, boost::mpl::false_)
+    {
+        for(; this->size != N && cur != end; ++cur, ++this->size)
+            ::new(this->data() + this->size) T(*cur);
+    }
+
+    // counts the elements once, rather than testing for the end at each
+    template<typename Iter>
+    void gather(Iter &cur, Iter const &end, boost::mpl::true_)
+    {
+        std::size_t const left = static_cast<std::size_t>(end - cur);
+        this->gather_n(cur, left < N ? left : N, boost::mpl::bool_<is_pod<T>::value>());
+    }
+
+    template<typename Iter>
+    void gather_n(Iter &cur, std::size_t count, boost::mpl::false_)
+    {
+        for(; this->size != count; ++cur, ++this->size)
+            ::new(this->data() + this->size) T(*cur);
+    }
+
+    // lets the standard library copy a segment at a time, e.g. from a deque
+    template<typename Iter>
+    void gather_n(Iter &cur, std::size_t count, boost::mpl::true_)
+    {
+        Iter const last = cur + static_cast<BOOST_DEDUCED_TYPENAME iterator_difference<Iter>::type>(count);
+        std::copy(cur, last, this->data());
+        cur = last;
+        this->size = count;
+    }
+
+    aligned_storage<sizeof(T) * N, alignment_of<T>::value> storage;
+    std::size_t size;
+
+private:
+    chunk_buffer &operator =(chunk_buffer const &);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// chunker_
+//   Cuts the elements between cur and end into chunks of N, and advances cur
+//   past each as it is taken. When the collection is iterated with pointers,
+//   the chunks point into it; otherwise each chunk is gathered into a buffer
+//   that lives as long as the loop.
+template<typename Iter, std::size_t N, bool Pointer = is_pointer<Iter>::value>
+struct chunker_
+{
+    typedef boost::foreach::chunk<BOOST_DEDUCED_TYPENAME remove_pointer<Iter>::type> chunk_type;
+
+    BOOST_FOREACH_DEBUG_INLINE chunk_type take(Iter &cur, Iter const &end)
+    {
+        std::size_t const left = static_cast<std::size_t>(end - cur);
+        chunk_type const chunk(cur, left < N ? left : N);
+        cur += chunk.size();
+        return chunk;
+    }
+};
+
+template<typename Iter, std::size_t N>
+struct chunker_<Iter, N, false>
+{
+    typedef BOOST_DEDUCED_TYPENAME iterator_value<Iter>::type value_type;
+    typedef boost::foreach::chunk<value_type const> chunk_type;
+
+    BOOST_FOREACH_DEBUG_INLINE chunk_type take(Iter &cur, Iter const &end)
+    {
+        this->buffer.gather(cur, end);
+        return chunk_type(this->buffer.data(), this->buffer.size);
+    }
+
+    chunk_buffer<value_type, N> buffer;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// chunk_begin
+//
+template<std::size_t N, typename T, typename C>
+inline auto_any<chunker_<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type, N> >
+chunk_begin(type2type<T, C> *)
+{
+    BOOST_MPL_ASSERT_MSG( (0 != N), BOOST_FOREACH_CHUNK_NEEDS_A_NONZERO_CHUNK_SIZE, (T&) );
+    return auto_any<chunker_<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type, N> >(
+        chunker_<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type, N>());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// chunk_take
 //
+template<std::size_t N, typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE
+BOOST_DEDUCED_TYPENAME chunker_<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type, N>::chunk_type
+chunk_take(auto_any_t chunker, auto_any_t cur, auto_any_t end, type2type<T, C> *)
+{
+    typedef BOOST_DEDUCED_TYPENAME bounded_iterator_<T, C>::type iter_t;
+    return auto_any_cast<chunker_<iter_t, N>, boost::mpl::false_>(chunker).take(
+        auto_any_cast<iter_t, boost::mpl::false_>(cur)
+      , auto_any_cast<iter_t, boost::mpl::false_>(end));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// fixed_extent_
+//   The number of elements of a collection whose size is part of its type,
+//   or 0 for other collections.
 template<typename T>
-struct rvalue_probe
+struct fixed_extent_
+  : boost::mpl::size_t<0>
+{
+};
+
+template<typename T, std::size_t N>
+struct fixed_extent_<T[N]>
+  : boost::mpl::size_t<N>
 {
-    struct private_type_ {};
-    // can't ever return an array by value
-    typedef BOOST_DEDUCED_TYPENAME boost::mpl::if_<
-        boost::mpl::or_<boost::is_abstract<T>, boost::is_array<T> >, private_type_, T
-    >::type value_type;
-    operator value_type() { return *reinterpret_cast<value_type *>(this); } // never called
-    operator T &() const { return *reinterpret_cast<T *>(const_cast<rvalue_probe *>(this)); } // never called
 };
 
+template<typename T, std::size_t N>
+struct fixed_extent_<boost::array<T, N> >
+  : boost::mpl::size_t<N>
+{
+};
+
+#if !defined(BOOST_NO_CXX11_HDR_ARRAY)
+template<typename T, std::size_t N>
+struct fixed_extent_<std::array<T, N> >
+  : boost::mpl::size_t<N>
+{
+};
+#endif
+
 template<typename T>
-rvalue_probe<T> const make_probe(T const &)
+struct small_extent_
+  : boost::mpl::size_t<
+        fixed_extent_<BOOST_DEDUCED_TYPENAME remove_cv<T>::type>::value <= BOOST_FOREACH_UNROLL_THRESHOLD
+      ? fixed_extent_<BOOST_DEDUCED_TYPENAME remove_cv<T>::type>::value
+      : 0
+    >
 {
-    return rvalue_probe<T>();
-}
+};
 
-# define BOOST_FOREACH_IS_RVALUE(COL)                                                           \
-    boost::foreach_detail_::and_(                                                               \
-        boost::foreach_detail_::not_(boost::foreach_detail_::is_array_(COL))                    \
-      , (true ? 0 : boost::foreach_detail_::is_rvalue_(                                         \
-            (true ? boost::foreach_detail_::make_probe(COL) : (COL)), 0)))
+///////////////////////////////////////////////////////////////////////////////
+// unrolled_
+//   BOOST_FOREACH_UNROLLED visits the elements in blocks, with an outer loop
+//   over the blocks and an inner loop over the elements of a block. A small
+//   collection of fixed size is a single block of N, so the inner loop has a
+//   constant trip count and is unrolled completely. Any other collection has
+//   blocks of one, and it is the outer loop that is unrolled. (The inner loop
+//   tests its condition with & rather than &&, as GCC ignores the unrolling
+//   pragma on a loop whose condition branches.)
+template<typename Iter, std::size_t N>
+struct unrolled_
+{
+    typedef BOOST_DEDUCED_TYPENAME iterator_difference<Iter>::type difference_type;
+
+    static BOOST_FORCEINLINE void next(Iter &cur)
+    {
+        cur += static_cast<difference_type>(N);
+    }
+
+    static BOOST_FORCEINLINE BOOST_DEDUCED_TYPENAME iterator_reference<Iter>::type
+    deref(Iter const &cur, std::size_t i)
+    {
+        return *(cur + static_cast<difference_type>(i));
+    }
+};
+
+template<typename Iter>
+struct unrolled_<Iter, 0>
+{
+    static BOOST_FORCEINLINE void next(Iter &cur)
+    {
+        ++cur;
+    }
+
+    static BOOST_FORCEINLINE BOOST_DEDUCED_TYPENAME iterator_reference<Iter>::type
+    deref(Iter const &cur, std::size_t)
+    {
+        return *cur;
+    }
+};
 
-#elif defined(BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION)
 ///////////////////////////////////////////////////////////////////////////////
-// Detect at run-time whether an expression yields an rvalue
-// or an lvalue. This is 100% standard C++, but not all compilers
-// accept it. Also, it causes FOREACH to break when used with non-
-// copyable collection types.
+// unroll_block
+//
+template<typename T, typename C>
+BOOST_FORCEINLINE std::size_t unroll_block(type2type<T, C> *)
+{
+    return 0 != small_extent_<T>::value ? small_extent_<T>::value : 1;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
+// unroll_next
+//   Advances to the next block, and says whether there is one. The loop
+//   conditions are plain bools: GCC drops the unrolling pragma from a loop
+//   whose condition calls a function that might throw.
+template<typename T, typename C>
+BOOST_FORCEINLINE bool unroll_next(bool more, auto_any_t cur, auto_any_t end, type2type<T, C> *)
+{
+    typedef BOOST_DEDUCED_TYPENAME bounded_iterator_<T, C>::type iter_t;
+    if(!more)
+        return false;
+    unrolled_<iter_t, small_extent_<T>::value>::next(auto_any_cast<iter_t, boost::mpl::false_>(cur));
+    return !(auto_any_cast<iter_t, boost::mpl::false_>(cur) == auto_any_cast<iter_t, boost::mpl::false_>(end));
+}
 
 ///////////////////////////////////////////////////////////////////////////////
-// rvalue_probe
+// unroll_deref
 //
-template<typename T>
-struct rvalue_probe
+template<typename T, typename C>
+BOOST_FORCEINLINE BOOST_DEDUCED_TYPENAME foreach_reference<T, C>::type
+unroll_deref(auto_any_t cur, std::size_t i, type2type<T, C> *)
 {
-    rvalue_probe(T &t, bool &b)
-      : value(t)
-      , is_rvalue(b)
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iter_t;
+    return unrolled_<iter_t, small_extent_<T>::value>::deref(auto_any_cast<iter_t, boost::mpl::false_>(cur), i);
+}
+
+#ifndef BOOST_FOREACH_NO_RANGE_BASED_FOR
+///////////////////////////////////////////////////////////////////////////////
+// native_sentinel
+//   The end of a native_range over a collection with a sentinel. A range-based
+//   for before C++20 tests for the end with !=, which a sentinel need not have;
+//   this tests it with ==, as done() does.
+template<typename Sentinel>
+struct native_sentinel
+{
+    native_sentinel(Sentinel const &end) BOOST_FOREACH_NOEXCEPT_IF(noexcept(Sentinel(end)))
+      : end(end)
     {
     }
 
-    struct private_type_ {};
-    // can't ever return an array or an abstract type by value
-    #ifdef BOOST_NO_IS_ABSTRACT
-    typedef BOOST_DEDUCED_TYPENAME boost::mpl::if_<
-        boost::is_array<T>, private_type_, T
-    >::type value_type;
-    #else
-    typedef BOOST_DEDUCED_TYPENAME boost::mpl::if_<
-        boost::mpl::or_<boost::is_abstract<T>, boost::is_array<T> >, private_type_, T
-    >::type value_type;
-    #endif
-    
-    operator value_type()
+    Sentinel end;
+};
+
+template<typename Iterator, typename Sentinel>
+BOOST_FOREACH_DEBUG_INLINE bool operator ==(Iterator const &it, native_sentinel<Sentinel> const &end)
+    BOOST_FOREACH_NOEXCEPT_IF(noexcept(static_cast<bool>(it == end.end)))
+{
+    return it == end.end;
+}
+
+template<typename Iterator, typename Sentinel>
+BOOST_FOREACH_DEBUG_INLINE bool operator !=(Iterator const &it, native_sentinel<Sentinel> const &end)
+    BOOST_FOREACH_NOEXCEPT_IF(noexcept(static_cast<bool>(it == end.end)))
+{
+    return !(it == end.end);
+}
+
+template<typename T, typename C>
+struct native_end_
+  : boost::mpl::if_<
+        BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::has_sentinel
+      , native_sentinel<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::sentinel>
+      , BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type
+    >
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// native_range_base
+//   native_range and native_reverse_range evaluate to false in boolean context,
+//   as auto_any_base does, so that they can be declared in if() statements and
+//   referred to from there by the loops that iterate over them.
+struct native_range_base
+{
+    BOOST_FOREACH_DEBUG_INLINE operator bool() const BOOST_FOREACH_NOEXCEPT
+    {
+        return false;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// native_range
+//   Adapts a collection for consumption by a range-based for loop. The
+//   collection is stored by value when BOOST_FOREACH would have copied it
+//   (rvalues and lightweight proxies), and by address otherwise.
+template<typename T, typename C, typename Copy>
+struct native_range
+  : native_range_base
+{
+    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iterator;
+    typedef BOOST_DEDUCED_TYPENAME native_end_<T, C>::type sentinel;
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::segmented segmented;
+
+    explicit native_range(type &t) BOOST_FOREACH_NOEXCEPT
+      : col(boost::addressof(t))
+    {
+    }
+
+    iterator begin() const BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterators_<T, C>::begin(BOOST_FOREACH_DEREFOF(this->col))))
+    {
+        return iterators_<T, C>::begin(BOOST_FOREACH_DEREFOF(this->col));
+    }
+
+    sentinel end() const BOOST_FOREACH_NOEXCEPT_IF(noexcept(sentinel(iterators_<T, C>::end(BOOST_FOREACH_DEREFOF(this->col)))))
+    {
+        return iterators_<T, C>::end(BOOST_FOREACH_DEREFOF(this->col));
+    }
+
+private:
+    type *col;
+};
+
+template<typename T, typename C>
+struct native_range<T, C, boost::mpl::true_>
+  : native_range_base
+{
+    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iterator;
+    typedef BOOST_DEDUCED_TYPENAME native_end_<T, C>::type sentinel;
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::segmented segmented;
+
+    explicit native_range(T const &t) BOOST_FOREACH_NOEXCEPT_IF(noexcept(T(t)))
+      : item(t)
+    {
+    }
+
+    explicit native_range(T &&t) BOOST_FOREACH_NOEXCEPT_IF(noexcept(T(std::move(t))))
+      : item(std::move(t))
+    {
+    }
+
+    iterator begin() BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterators_<T, C>::begin(static_cast<type &>(this->item))))
+    {
+        return iterators_<T, C>::begin(static_cast<type &>(this->item));
+    }
+
+    sentinel end() BOOST_FOREACH_NOEXCEPT_IF(noexcept(sentinel(iterators_<T, C>::end(static_cast<type &>(this->item)))))
+    {
+        return iterators_<T, C>::end(static_cast<type &>(this->item));
+    }
+
+private:
+    T item;
+};
+
+template<typename T, typename C>
+struct native_range<T *, C, boost::mpl::true_> // null-terminated C-style strings
+  : native_range_base
+{
+    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T *, C>::type iterator;
+    typedef boost::mpl::false_ segmented;
+
+    explicit native_range(T *p) BOOST_FOREACH_NOEXCEPT
+      : item(p)
+    {
+    }
+
+    iterator begin() const BOOST_FOREACH_NOEXCEPT
+    {
+        return iterator(this->item);
+    }
+
+    iterator end() const BOOST_FOREACH_NOEXCEPT
+    {
+        return iterator(cstr_end(this->item));
+    }
+
+private:
+    T *item;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// native_reverse_range
+//
+template<typename T, typename C, typename Copy>
+struct native_reverse_range
+  : native_range_base
+{
+    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
+    typedef BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type iterator;
+
+    explicit native_reverse_range(type &t) BOOST_FOREACH_NOEXCEPT
+      : col(boost::addressof(t))
     {
-        this->is_rvalue = true;
-        return this->value;
     }
 
-    operator T &() const
+    iterator begin() const BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterators_<T, C>::rbegin(BOOST_FOREACH_DEREFOF(this->col))))
     {
-        return this->value;
+        return iterators_<T, C>::rbegin(BOOST_FOREACH_DEREFOF(this->col));
+    }
+
+    iterator end() const BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterators_<T, C>::rend(BOOST_FOREACH_DEREFOF(this->col))))
+    {
+        return iterators_<T, C>::rend(BOOST_FOREACH_DEREFOF(this->col));
     }
 
 private:
-    T &value;
-    bool &is_rvalue;
+    type *col;
 };
 
-template<typename T>
-rvalue_probe<T> make_probe(T &t, bool &b) { return rvalue_probe<T>(t, b); }
-
-template<typename T>
-rvalue_probe<T const> make_probe(T const &t, bool &b)  { return rvalue_probe<T const>(t, b); }
-
-///////////////////////////////////////////////////////////////////////////////
-// simple_variant
-//  holds either a T or a T const*
-template<typename T>
-struct simple_variant
+template<typename T, typename C>
+struct native_reverse_range<T, C, boost::mpl::true_>
+  : native_range_base
 {
-    simple_variant(T const *t)
-      : is_rvalue(false)
-    {
-        *static_cast<T const **>(this->data.address()) = t;
-    }
+    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
+    typedef BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type iterator;
 
-    simple_variant(T const &t)
-      : is_rvalue(true)
+    explicit native_reverse_range(T const &t) BOOST_FOREACH_NOEXCEPT_IF(noexcept(T(t)))
+      : item(t)
     {
-        ::new(this->data.address()) T(t);
     }
 
-    simple_variant(simple_variant const &that)
-      : is_rvalue(that.is_rvalue)
+    explicit native_reverse_range(T &&t) BOOST_FOREACH_NOEXCEPT_IF(noexcept(T(std::move(t))))
+      : item(std::move(t))
     {
-        if(this->is_rvalue)
-            ::new(this->data.address()) T(*that.get());
-        else
-            *static_cast<T const **>(this->data.address()) = that.get();
     }
 
-    ~simple_variant()
+    iterator begin() BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterators_<T, C>::rbegin(static_cast<type &>(this->item))))
     {
-        if(this->is_rvalue)
-            this->get()->~T();
+        return iterators_<T, C>::rbegin(static_cast<type &>(this->item));
     }
 
-    T const *get() const
+    iterator end() BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterators_<T, C>::rend(static_cast<type &>(this->item))))
     {
-        if(this->is_rvalue)
-            return static_cast<T const *>(this->data.address());
-        else
-            return *static_cast<T const * const *>(this->data.address());
+        return iterators_<T, C>::rend(static_cast<type &>(this->item));
     }
 
 private:
-    enum size_type { size = sizeof(T) > sizeof(T*) ? sizeof(T) : sizeof(T*) };
-    simple_variant &operator =(simple_variant const &); 
-    bool const is_rvalue;
-    aligned_storage<size> data;
+    T item;
 };
 
-// If the collection is an array or is noncopyable, it must be an lvalue.
-// If the collection is a lightweight proxy, treat it as an rvalue
-// BUGBUG what about a noncopyable proxy?
-template<typename LValue, typename IsProxy>
-inline BOOST_DEDUCED_TYPENAME boost::enable_if<boost::mpl::or_<LValue, IsProxy>, IsProxy>::type *
-should_copy_impl(LValue *, IsProxy *, bool *)
+template<typename T, typename C>
+struct native_reverse_range<T *, C, boost::mpl::true_> // null-terminated C-style strings
+  : native_range_base
 {
-    return 0;
-}
+    typedef reverse_iterator<T *> iterator;
 
-// Otherwise, we must determine at runtime whether it's an lvalue or rvalue
-inline bool *
-should_copy_impl(boost::mpl::false_ *, boost::mpl::false_ *, bool *is_rvalue)
-{
-    return is_rvalue;
-}
+    explicit native_reverse_range(T *p) BOOST_FOREACH_NOEXCEPT
+      : item(p)
+    {
+    }
 
-#endif
+    iterator begin() const BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterator(cstr_end(this->item))))
+    {
+        return iterator(cstr_end(this->item));
+    }
+
+    iterator end() const BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterator(this->item)))
+    {
+        return iterator(this->item);
+    }
+
+private:
+    T *item;
+};
 
 ///////////////////////////////////////////////////////////////////////////////
-// contain
+// make_native_range/make_native_reverse_range
 //
-template<typename T>
-inline auto_any<T> contain(T const &t, boost::mpl::true_ *) // rvalue
+template<typename U, typename T, typename C>
+inline native_range<T, C, boost::mpl::true_>
+make_native_range(U &&u, type2type<T, C> *, boost::mpl::true_ *) // rvalue
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(native_range<T, C, boost::mpl::true_>(std::forward<U>(u)))))
 {
-    return auto_any<T>(t);
+    return native_range<T, C, boost::mpl::true_>(std::forward<U>(u));
 }
 
-template<typename T>
-inline auto_any<T *> contain(T &t, boost::mpl::false_ *) // lvalue
+template<typename U, typename T, typename C>
+inline native_range<T, C, boost::mpl::false_>
+make_native_range(U &u, type2type<T, C> *, boost::mpl::false_ *) // lvalue
+    BOOST_FOREACH_NOEXCEPT
 {
-    // Cannot seem to get sunpro to handle addressof() with array types.
-    #if BOOST_WORKAROUND(__SUNPRO_CC, BOOST_TESTED_AT(0x570))
-    return auto_any<T *>(&t);
-    #else
-    return auto_any<T *>(boost::addressof(t));
-    #endif
+    return native_range<T, C, boost::mpl::false_>(u);
 }
 
-#ifdef BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION
-template<typename T>
-inline auto_any<simple_variant<T> >
-contain(T const &t, bool *rvalue)
+template<typename U, typename T, typename C>
+inline native_reverse_range<T, C, boost::mpl::true_>
+make_native_reverse_range(U &&u, type2type<T, C> *, boost::mpl::true_ *) // rvalue
+    BOOST_FOREACH_NOEXCEPT_IF((noexcept(native_reverse_range<T, C, boost::mpl::true_>(std::forward<U>(u)))))
 {
-    return auto_any<simple_variant<T> >(*rvalue ? simple_variant<T>(t) : simple_variant<T>(&t));
+    return native_reverse_range<T, C, boost::mpl::true_>(std::forward<U>(u));
 }
-#endif
 
-/////////////////////////////////////////////////////////////////////////////
-// begin
-//
-template<typename T, typename C>
-inline auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>
-begin(auto_any_t col, type2type<T, C> *, boost::mpl::true_ *) // rvalue
+template<typename U, typename T, typename C>
+inline native_reverse_range<T, C, boost::mpl::false_>
+make_native_reverse_range(U &u, type2type<T, C> *, boost::mpl::false_ *) // lvalue
+    BOOST_FOREACH_NOEXCEPT
 {
-    return auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>(
-        boost::begin(auto_any_cast<T, C>(col)));
+    return native_reverse_range<T, C, boost::mpl::false_>(u);
 }
 
-template<typename T, typename C>
-inline auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>
-begin(auto_any_t col, type2type<T, C> *, boost::mpl::false_ *) // lvalue
+///////////////////////////////////////////////////////////////////////////////
+// native_segments
+//   The blocks of a native_range, for a range-based for over the elements of
+//   each block nested in one over the blocks. The native_range is held by
+//   reference; it is declared once, before the loops. Which of the two is used
+//   is chosen at compile time, by Range::segmented. A range that is not
+//   segmented is a single block, the range itself, which is walked with its own
+//   iterator as without the segments. The blocks of a segmented range are
+//   pointer ranges, whose end notes when the inner loop reaches it; the outer
+//   loop goes on to the next block only if it did, so that a break in the
+//   inner loop ends both.
+template<typename Pointer>
+struct segment_end
 {
-    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
-    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iterator;
-    return auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>(
-        iterator(boost::begin(BOOST_FOREACH_DEREFOF((auto_any_cast<type *, boost::mpl::false_>(col))))));
-}
+    segment_end(Pointer last, bool *reached) BOOST_FOREACH_NOEXCEPT_IF(noexcept(Pointer(last)))
+      : last(last)
+      , reached(reached)
+    {
+    }
 
-#ifdef BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION
-template<typename T>
-inline auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, const_>::type>
-begin(auto_any_t col, type2type<T, const_> *, bool *)
-{
-    return auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, const_>::type>(
-        boost::begin(*auto_any_cast<simple_variant<T>, boost::mpl::false_>(col).get()));
-}
-#endif
+    Pointer last;
+    bool *reached;
+};
 
-#ifndef BOOST_NO_FUNCTION_TEMPLATE_ORDERING
-template<typename T, typename C>
-inline auto_any<T *>
-begin(auto_any_t col, type2type<T *, C> *, boost::mpl::true_ *) // null-terminated C-style strings
+template<typename Pointer>
+BOOST_FOREACH_DEBUG_INLINE bool operator ==(Pointer const &it, segment_end<Pointer> const &end)
+    BOOST_FOREACH_NOEXCEPT_IF(noexcept(static_cast<bool>(it != end.last)))
 {
-    return auto_any<T *>(auto_any_cast<T *, boost::mpl::false_>(col));
+    if(it != end.last)
+        return false;
+    *end.reached = true;
+    return true;
 }
-#endif
 
-///////////////////////////////////////////////////////////////////////////////
-// end
-//
-template<typename T, typename C>
-inline auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>
-end(auto_any_t col, type2type<T, C> *, boost::mpl::true_ *) // rvalue
+template<typename Pointer>
+BOOST_FOREACH_DEBUG_INLINE bool operator !=(Pointer const &it, segment_end<Pointer> const &end)
+    BOOST_FOREACH_NOEXCEPT_IF(noexcept(static_cast<bool>(it != end.last)))
 {
-    return auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>(
-        boost::end(auto_any_cast<T, C>(col)));
+    return !(it == end);
 }
 
-template<typename T, typename C>
-inline auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>
-end(auto_any_t col, type2type<T, C> *, boost::mpl::false_ *) // lvalue
+template<typename Pointer>
+struct segment_range
 {
-    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
-    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iterator;
-    return auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>(
-        iterator(boost::end(BOOST_FOREACH_DEREFOF((auto_any_cast<type *, boost::mpl::false_>(col))))));
-}
+    segment_range(Pointer first, segment_end<Pointer> const &last) BOOST_FOREACH_NOEXCEPT_IF(noexcept(Pointer(first)))
+      : first(first)
+      , last(last)
+    {
+    }
 
-#ifdef BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION
-template<typename T>
-inline auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, const_>::type>
-end(auto_any_t col, type2type<T, const_> *, bool *)
-{
-    return auto_any<BOOST_DEDUCED_TYPENAME foreach_iterator<T, const_>::type>(
-        boost::end(*auto_any_cast<simple_variant<T>, boost::mpl::false_>(col).get()));
-}
-#endif
+    Pointer begin() const BOOST_FOREACH_NOEXCEPT_IF(noexcept(Pointer(this->first)))
+    {
+        return this->first;
+    }
 
-#ifndef BOOST_NO_FUNCTION_TEMPLATE_ORDERING
-template<typename T, typename C>
-inline auto_any<int>
-end(auto_any_t, type2type<T *, C> *, boost::mpl::true_ *) // null-terminated C-style strings
+    segment_end<Pointer> end() const BOOST_FOREACH_NOEXCEPT_IF(noexcept(Pointer(this->first)))
+    {
+        return this->last;
+    }
+
+private:
+    Pointer first;
+    segment_end<Pointer> last;
+};
+
+struct segments_end
 {
-    return auto_any<int>(0); // not used
-}
-#endif
+};
 
-///////////////////////////////////////////////////////////////////////////////
-// done
-//
-template<typename T, typename C>
-inline bool done(auto_any_t cur, auto_any_t end, type2type<T, C> *)
+template<typename Range, typename Segmented = BOOST_DEDUCED_TYPENAME Range::segmented>
+struct native_segments
 {
-    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iter_t;
-    return auto_any_cast<iter_t, boost::mpl::false_>(cur) == auto_any_cast<iter_t, boost::mpl::false_>(end);
-}
+    struct iterator
+    {
+        explicit iterator(Range *rng) BOOST_FOREACH_NOEXCEPT
+          : rng(rng)
+        {
+        }
+
+        BOOST_FOREACH_DEBUG_INLINE Range &operator *() const BOOST_FOREACH_NOEXCEPT
+        {
+            return *this->rng;
+        }
+
+        BOOST_FOREACH_DEBUG_INLINE iterator &operator ++() BOOST_FOREACH_NOEXCEPT
+        {
+            this->rng = 0;
+            return *this;
+        }
+
+        BOOST_FOREACH_DEBUG_INLINE bool operator !=(iterator const &that) const BOOST_FOREACH_NOEXCEPT
+        {
+            return this->rng != that.rng;
+        }
+
+    private:
+        Range *rng;
+    };
 
-#ifndef BOOST_NO_FUNCTION_TEMPLATE_ORDERING
-template<typename T, typename C>
-inline bool done(auto_any_t cur, auto_any_t, type2type<T *, C> *) // null-terminated C-style strings
+    explicit native_segments(Range &rng) BOOST_FOREACH_NOEXCEPT
+      : rng(rng)
+    {
+    }
+
+    iterator begin() BOOST_FOREACH_NOEXCEPT
+    {
+        return iterator(boost::addressof(this->rng));
+    }
+
+    iterator end() BOOST_FOREACH_NOEXCEPT
+    {
+        return iterator(0);
+    }
+
+private:
+    Range &rng;
+};
+
+template<typename Range>
+struct native_segments<Range, boost::mpl::true_>
 {
-    return ! *auto_any_cast<T *, boost::mpl::false_>(cur);
-}
-#endif
+    typedef BOOST_DEDUCED_TYPENAME Range::iterator iter_t;
+    typedef BOOST_DEDUCED_TYPENAME segment_block_<iter_t>::type block;
+    typedef BOOST_DEDUCED_TYPENAME block::iterator pointer;
 
-///////////////////////////////////////////////////////////////////////////////
-// next
-//
-template<typename T, typename C>
-inline void next(auto_any_t cur, type2type<T, C> *)
+    struct iterator
+    {
+        iterator(iter_t cur, iter_t end)
+          : cur(cur)
+          , end(end)
+          , first()
+          , last()
+          , reached(true)
+          , more(true)
+        {
+            this->take();
+        }
+
+        segment_range<pointer> operator *() const BOOST_FOREACH_NOEXCEPT_IF(noexcept(pointer(this->first)))
+        {
+            this->reached = false;
+            return segment_range<pointer>(this->first, segment_end<pointer>(this->last, &this->reached));
+        }
+
+        iterator &operator ++()
+        {
+            if(this->reached)
+                this->take();
+            else
+                this->more = false;
+            return *this;
+        }
+
+        bool operator ==(segments_end) const BOOST_FOREACH_NOEXCEPT
+        {
+            return !this->more;
+        }
+
+        bool operator !=(segments_end) const BOOST_FOREACH_NOEXCEPT
+        {
+            return this->more;
+        }
+
+    private:
+        void take()
+        {
+            if(this->cur == this->end)
+            {
+                this->more = false;
+                return;
+            }
+            block const blk = boost::foreach::segmented_iterator<iter_t>::segment(this->cur, this->end);
+            this->first = blk.begin();
+            this->last = blk.end();
+            this->cur += static_cast<BOOST_DEDUCED_TYPENAME iterator_difference<iter_t>::type>(blk.size());
+        }
+
+        iter_t cur;
+        iter_t end;
+        pointer first;
+        pointer last;
+        mutable bool reached;
+        bool more;
+    };
+
+    explicit native_segments(Range &rng) BOOST_FOREACH_NOEXCEPT
+      : rng(rng)
+    {
+    }
+
+    iterator begin()
+    {
+        return iterator(this->rng.begin(), this->rng.end());
+    }
+
+    segments_end end() BOOST_FOREACH_NOEXCEPT
+    {
+        return segments_end();
+    }
+
+private:
+    Range &rng;
+};
+
+template<typename Range>
+inline native_segments<Range> segments(Range &rng) BOOST_FOREACH_NOEXCEPT
 {
-    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iter_t;
-    ++auto_any_cast<iter_t, boost::mpl::false_>(cur);
+    return native_segments<Range>(rng);
 }
 
+#ifdef BOOST_NO_CXX17_IF_CONSTEXPR
 ///////////////////////////////////////////////////////////////////////////////
-// deref
-//
-template<typename T, typename C>
-inline BOOST_DEDUCED_TYPENAME foreach_reference<T, C>::type
-deref(auto_any_t cur, type2type<T, C> *)
+// guarded_range
+//   Without selection statements with initializers, the loop variable can only
+//   be declared by nesting a second loop, which swallows a break in the loop
+//   body. guarded_range stops the outer range-based for when the loop body
+//   breaks, without advancing the iterator past the element it broke on.
+//   The begin and end of a range-based for must then be of the same type; if
+//   the range's end is a sentinel, the range keeps it, and both compare their
+//   iterator with it. A range that is an lvalue, like a block of
+//   native_segments, is guarded by reference.
+template<typename Iterator, typename Sentinel = Iterator>
+struct guarded_iterator
 {
-    typedef BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type iter_t;
-    return *auto_any_cast<iter_t, boost::mpl::false_>(cur);
-}
+    guarded_iterator(Iterator it, Sentinel const &end, bool const &cont) BOOST_FOREACH_NOEXCEPT_IF(noexcept(Iterator(it)))
+      : it(it)
+      , end(&end)
+      , cont(&cont)
+    {
+    }
 
-/////////////////////////////////////////////////////////////////////////////
-// rbegin
-//
-template<typename T, typename C>
-inline auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>
-rbegin(auto_any_t col, type2type<T, C> *, boost::mpl::true_ *) // rvalue
-{
-    return auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>(
-        boost::rbegin(auto_any_cast<T, C>(col)));
-}
+    BOOST_FOREACH_DEBUG_INLINE decltype(*std::declval<Iterator const &>()) operator *() const
+        BOOST_FOREACH_NOEXCEPT_IF(noexcept(*this->it))
+    {
+        return *this->it;
+    }
 
-template<typename T, typename C>
-inline auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>
-rbegin(auto_any_t col, type2type<T, C> *, boost::mpl::false_ *) // lvalue
-{
-    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
-    typedef BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type iterator;
-    return auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>(
-        iterator(boost::rbegin(BOOST_FOREACH_DEREFOF((auto_any_cast<type *, boost::mpl::false_>(col))))));
-}
+    BOOST_FOREACH_DEBUG_INLINE guarded_iterator &operator ++() BOOST_FOREACH_NOEXCEPT_IF(noexcept(++this->it))
+    {
+        if(*this->cont)
+            ++this->it;
+        return *this;
+    }
 
-#ifdef BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION
-template<typename T>
-inline auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, const_>::type>
-rbegin(auto_any_t col, type2type<T, const_> *, bool *)
+    BOOST_FOREACH_DEBUG_INLINE bool operator !=(guarded_iterator const &) const
+        BOOST_FOREACH_NOEXCEPT_IF(noexcept(static_cast<bool>(this->it == *this->end)))
+    {
+        return *this->cont && !(this->it == *this->end);
+    }
+
+private:
+    Iterator it;
+    Sentinel const *end;
+    bool const *cont;
+};
+
+template<typename Iterator>
+struct guarded_iterator<Iterator, Iterator>
 {
-    return auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, const_>::type>(
-        boost::rbegin(*auto_any_cast<simple_variant<T>, boost::mpl::false_>(col).get()));
-}
-#endif
+    guarded_iterator(Iterator it, bool const &cont) BOOST_FOREACH_NOEXCEPT_IF(noexcept(Iterator(it)))
+      : it(it)
+      , cont(&cont)
+    {
+    }
+
+    BOOST_FOREACH_DEBUG_INLINE decltype(*std::declval<Iterator const &>()) operator *() const
+        BOOST_FOREACH_NOEXCEPT_IF(noexcept(*this->it))
+    {
+        return *this->it;
+    }
+
+    BOOST_FOREACH_DEBUG_INLINE guarded_iterator &operator ++() BOOST_FOREACH_NOEXCEPT_IF(noexcept(++this->it))
+    {
+        if(*this->cont)
+            ++this->it;
+        return *this;
+    }
 
-#ifndef BOOST_NO_FUNCTION_TEMPLATE_ORDERING
-template<typename T, typename C>
-inline auto_any<reverse_iterator<T *> >
-rbegin(auto_any_t col, type2type<T *, C> *, boost::mpl::true_ *) // null-terminated C-style strings
-{
-    T *p = auto_any_cast<T *, boost::mpl::false_>(col);
-    while(0 != *p)
-        ++p;
-    return auto_any<reverse_iterator<T *> >(reverse_iterator<T *>(p));
-}
-#endif
+    BOOST_FOREACH_DEBUG_INLINE bool operator !=(guarded_iterator const &that) const
+        BOOST_FOREACH_NOEXCEPT_IF(noexcept(static_cast<bool>(this->it != that.it)))
+    {
+        return *this->cont && this->it != that.it;
+    }
 
-///////////////////////////////////////////////////////////////////////////////
-// rend
-//
-template<typename T, typename C>
-inline auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>
-rend(auto_any_t col, type2type<T, C> *, boost::mpl::true_ *) // rvalue
-{
-    return auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>(
-        boost::rend(auto_any_cast<T, C>(col)));
-}
+private:
+    Iterator it;
+    bool const *cont;
+};
 
-template<typename T, typename C>
-inline auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>
-rend(auto_any_t col, type2type<T, C> *, boost::mpl::false_ *) // lvalue
+template<
+    typename Range
+  , typename Iterator = decltype(std::declval<Range &>().begin())
+  , typename Sentinel = decltype(std::declval<Range &>().end())
+>
+struct guarded_range
 {
-    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
-    typedef BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type iterator;
-    return auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type>(
-        iterator(boost::rend(BOOST_FOREACH_DEREFOF((auto_any_cast<type *, boost::mpl::false_>(col))))));
-}
+    typedef guarded_iterator<Iterator, Sentinel> iterator;
 
-#ifdef BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION
-template<typename T>
-inline auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, const_>::type>
-rend(auto_any_t col, type2type<T, const_> *, bool *)
-{
-    return auto_any<BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, const_>::type>(
-        boost::rend(*auto_any_cast<simple_variant<T>, boost::mpl::false_>(col).get()));
-}
-#endif
+    guarded_range(Range &&rng, bool const &cont)
+      : rng(std::forward<Range>(rng))
+      , first(this->rng.begin())
+      , last(this->rng.end())
+      , cont(cont)
+    {
+    }
 
-#ifndef BOOST_NO_FUNCTION_TEMPLATE_ORDERING
-template<typename T, typename C>
-inline auto_any<reverse_iterator<T *> >
-rend(auto_any_t col, type2type<T *, C> *, boost::mpl::true_ *) // null-terminated C-style strings
-{
-    return auto_any<reverse_iterator<T *> >(
-        reverse_iterator<T *>(auto_any_cast<T *, boost::mpl::false_>(col)));
-}
-#endif
+    iterator begin() BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterator(this->first, this->last, this->cont)))
+    {
+        return iterator(this->first, this->last, this->cont);
+    }
 
-///////////////////////////////////////////////////////////////////////////////
-// rdone
-//
-template<typename T, typename C>
-inline bool rdone(auto_any_t cur, auto_any_t end, type2type<T, C> *)
+    iterator end() BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterator(this->first, this->last, this->cont)))
+    {
+        return iterator(this->first, this->last, this->cont);
+    }
+
+private:
+    Range rng;
+    Iterator first;
+    Sentinel last;
+    bool const &cont;
+};
+
+template<typename Range, typename Iterator>
+struct guarded_range<Range, Iterator, Iterator>
 {
-    typedef BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type iter_t;
-    return auto_any_cast<iter_t, boost::mpl::false_>(cur) == auto_any_cast<iter_t, boost::mpl::false_>(end);
-}
+    typedef guarded_iterator<Iterator> iterator;
 
-///////////////////////////////////////////////////////////////////////////////
-// rnext
-//
-template<typename T, typename C>
-inline void rnext(auto_any_t cur, type2type<T, C> *)
+    guarded_range(Range &&rng, bool const &cont)
+      : rng(std::forward<Range>(rng))
+      , cont(cont)
+    {
+    }
+
+    iterator begin() BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterator(this->rng.begin(), this->cont)))
+    {
+        return iterator(this->rng.begin(), this->cont);
+    }
+
+    iterator end() BOOST_FOREACH_NOEXCEPT_IF(noexcept(iterator(this->rng.end(), this->cont)))
+    {
+        return iterator(this->rng.end(), this->cont);
+    }
+
+private:
+    Range rng;
+    bool const &cont;
+};
+
+template<typename Range>
+inline guarded_range<Range> guard(Range &&rng, bool const &cont)
 {
-    typedef BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type iter_t;
-    ++auto_any_cast<iter_t, boost::mpl::false_>(cur);
+    return guarded_range<Range>(std::forward<Range>(rng), cont);
 }
 
-///////////////////////////////////////////////////////////////////////////////
-// rderef
-//
-template<typename T, typename C>
-inline BOOST_DEDUCED_TYPENAME foreach_reference<T, C>::type
-rderef(auto_any_t cur, type2type<T, C> *)
+// The single block of a range that is not segmented is all there is, so the
+// loop over the blocks ends after it with or without a break, and is not
+// guarded.
+template<typename Range>
+inline native_segments<Range, boost::mpl::false_> guard(native_segments<Range, boost::mpl::false_> segs, bool const &)
+    BOOST_FOREACH_NOEXCEPT
 {
-    typedef BOOST_DEDUCED_TYPENAME foreach_reverse_iterator<T, C>::type iter_t;
-    return *auto_any_cast<iter_t, boost::mpl::false_>(cur);
+    return segs;
 }
+#endif
+
+#endif // BOOST_FOREACH_NO_RANGE_BASED_FOR
 
 } // namespace foreach_detail_
 } // namespace boost
@@ -1020,6 +3695,27 @@ rderef(auto_any_t cur, type2type<T, C> *)
         BOOST_FOREACH_EVALUATE(COL)                                                             \
       , BOOST_FOREACH_SHOULD_COPY(COL))
 
+// Follows the containment of the collection, when its rvalue-ness is known
+// even where it is detected at run time. See check_copy and
+// <boost/foreach_audit.hpp>.
+#if defined(BOOST_FOREACH_AUDIT_COPIES)
+# define BOOST_FOREACH_AUDIT_COPY(COL)                                                          \
+    if (boost::foreach_detail_::audit_copy(                                                     \
+            BOOST_FOREACH_TYPEOF(COL)                                                           \
+          , BOOST_FOREACH_SHOULD_COPY(COL)                                                      \
+          , true ? BOOST_FOREACH_NULL : BOOST_FOREACH_IS_LIGHTWEIGHT_PROXY(COL)                \
+          , (boost::mpl::identity<decltype((COL))> *)0                                          \
+          , __FILE__, __LINE__, []{})) {} else
+#elif defined(BOOST_FOREACH_MAX_COPY_SIZE)
+# define BOOST_FOREACH_AUDIT_COPY(COL)                                                          \
+    if (boost::foreach_detail_::check_copy(                                                     \
+            BOOST_FOREACH_TYPEOF(COL)                                                           \
+          , BOOST_FOREACH_SHOULD_COPY(COL)                                                      \
+          , true ? BOOST_FOREACH_NULL : BOOST_FOREACH_IS_LIGHTWEIGHT_PROXY(COL))) {} else
+#else
+# define BOOST_FOREACH_AUDIT_COPY(COL)
+#endif
+
 #define BOOST_FOREACH_BEGIN(COL)                                                                \
     boost::foreach_detail_::begin(                                                              \
         BOOST_FOREACH_ID(_foreach_col)                                                          \
@@ -1076,6 +3772,337 @@ rderef(auto_any_t cur, type2type<T, C> *)
         BOOST_FOREACH_ID(_foreach_cur)                                                          \
       , BOOST_FOREACH_TYPEOF(COL))
 
+#if defined(BOOST_FOREACH_COMPILE_TIME_CONST_RVALUE_DETECTION)                                \
+ && !defined(BOOST_NO_CXX11_RVALUE_REFERENCES) && !defined(BOOST_NO_CXX11_DECLTYPE)
+// true_* if BOOST_FOREACH_CONSUME moves the elements out of the collection
+# define BOOST_FOREACH_SHOULD_CONSUME(COL)                                                      \
+    boost::foreach_detail_::should_consume(                                                     \
+        BOOST_FOREACH_TYPEOF(COL)                                                               \
+      , (boost::mpl::identity<decltype((COL))> *)0)
+
+// The type of the collection, mutable if BOOST_FOREACH_CONSUME consumes it
+# define BOOST_FOREACH_CONSUME_TYPEOF(COL)                                                      \
+    boost::foreach_detail_::consume_type(                                                       \
+        BOOST_FOREACH_TYPEOF(COL)                                                               \
+      , BOOST_FOREACH_SHOULD_CONSUME(COL))
+#endif
+
+// The segment_ of the collection, which selects the overloads for segmented collections
+#define BOOST_FOREACH_SEGMENT_TYPEOF(COL)                                                       \
+    (true ? BOOST_FOREACH_NULL : boost::foreach_detail_::segment_type(BOOST_FOREACH_TYPEOF(COL)))
+
+#define BOOST_FOREACH_SEGMENTS_BEGIN(COL)                                                       \
+    boost::foreach_detail_::segments_begin(                                                     \
+        BOOST_FOREACH_ID(_foreach_cur)                                                          \
+      , BOOST_FOREACH_ID(_foreach_end)                                                          \
+      , BOOST_FOREACH_SEGMENT_TYPEOF(COL))
+
+#define BOOST_FOREACH_SEGMENT(COL)                                                              \
+    boost::foreach_detail_::segment(                                                            \
+        BOOST_FOREACH_ID(_foreach_cur)                                                          \
+      , BOOST_FOREACH_ID(_foreach_end)                                                          \
+      , BOOST_FOREACH_ID(_foreach_more)                                                         \
+      , BOOST_FOREACH_SEGMENT_TYPEOF(COL))
+
+#define BOOST_FOREACH_SEGMENT_DONE(COL)                                                         \
+    boost::foreach_detail_::segment_done(                                                       \
+        BOOST_FOREACH_ID(_foreach_cur)                                                          \
+      , BOOST_FOREACH_ID(_foreach_end)                                                          \
+      , BOOST_FOREACH_ID(_foreach_seg)                                                          \
+      , BOOST_FOREACH_SEGMENT_TYPEOF(COL))
+
+#define BOOST_FOREACH_SEGMENT_NEXT(COL)                                                         \
+    boost::foreach_detail_::segment_next(                                                       \
+        BOOST_FOREACH_ID(_foreach_cur)                                                          \
+      , BOOST_FOREACH_ID(_foreach_seg)                                                          \
+      , BOOST_FOREACH_SEGMENT_TYPEOF(COL))
+
+#define BOOST_FOREACH_SEGMENT_DEREF(COL)                                                        \
+    boost::foreach_detail_::segment_deref(                                                      \
+        BOOST_FOREACH_ID(_foreach_cur)                                                          \
+      , BOOST_FOREACH_ID(_foreach_seg)                                                          \
+      , BOOST_FOREACH_SEGMENT_TYPEOF(COL))
+
+// A sneaky way to get the iterator type of the collection, as for BOOST_FOREACH_TYPEOF
+#define BOOST_FOREACH_ITERATOR_TYPE(COL)                                                        \
+    (true ? BOOST_FOREACH_NULL : boost::foreach_detail_::iterator_type(BOOST_FOREACH_TYPEOF(COL)))
+
+#define BOOST_FOREACH_REVERSE_ITERATOR_TYPE(COL)                                                \
+    (true ? BOOST_FOREACH_NULL : boost::foreach_detail_::reverse_iterator_type(BOOST_FOREACH_TYPEOF(COL)))
+
+#define BOOST_FOREACH_INDEX_BEGIN(ITER)                                                         \
+    boost::foreach_detail_::index_begin(                                                        \
+        BOOST_FOREACH_ID(_foreach_cur)                                                          \
+      , BOOST_FOREACH_ID(_foreach_end)                                                          \
+      , ITER)
+
+#define BOOST_FOREACH_INDEX_DONE(ITER)                                                          \
+    boost::foreach_detail_::index_done(                                                         \
+        BOOST_FOREACH_ID(_foreach_idx)                                                          \
+      , BOOST_FOREACH_ID(_foreach_cur)                                                          \
+      , BOOST_FOREACH_ID(_foreach_end)                                                          \
+      , ITER)
+
+#define BOOST_FOREACH_INDEX_NEXT(ITER)                                                          \
+    boost::foreach_detail_::index_next(                                                         \
+        BOOST_FOREACH_ID(_foreach_idx)                                                          \
+      , BOOST_FOREACH_ID(_foreach_cur)                                                          \
+      , ITER)
+
+#define BOOST_FOREACH_INDEX_DEREF(ITER)                                                         \
+    boost::foreach_detail_::index_deref(                                                        \
+        BOOST_FOREACH_ID(_foreach_idx)                                                          \
+      , BOOST_FOREACH_ID(_foreach_cur)                                                          \
+      , ITER)
+
+// Like the classic BOOST_FOREACH loop, with one more loop to declare the index.
+// A break in the body leaves _foreach_continue false; _foreach_index_set then
+// ends the index loop and _foreach_continue ends the outer one.
+#define BOOST_FOREACH_INDEXED_FOR(IDX, VAR, COL, BEGIN, END, ITER)                                                \
+    BOOST_FOREACH_PREAMBLE()                                                                                      \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_col) = BOOST_FOREACH_CONTAIN(COL)) {} else   \
+    BOOST_FOREACH_AUDIT_COPY(COL)                                                                                 \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_cur) = BEGIN(COL)) {} else                   \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_end) = END(COL)) {} else                     \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_idx) = BOOST_FOREACH_INDEX_BEGIN(ITER)) {} else \
+    if (bool BOOST_FOREACH_ID(_foreach_index_set) = false) {} else                                                \
+    for (bool BOOST_FOREACH_ID(_foreach_continue) = true;                                                         \
+              BOOST_FOREACH_ID(_foreach_continue) && !BOOST_FOREACH_INDEX_DONE(ITER);                             \
+              BOOST_FOREACH_ID(_foreach_continue) ? BOOST_FOREACH_INDEX_NEXT(ITER) : (void)0)                     \
+        if  (boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_continue)) ||                            \
+             boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_index_set))) {} else                     \
+        for (IDX = boost::foreach_detail_::index_value(BOOST_FOREACH_ID(_foreach_idx));                           \
+                  !BOOST_FOREACH_ID(_foreach_index_set); BOOST_FOREACH_ID(_foreach_index_set) = true)             \
+        for (VAR = BOOST_FOREACH_INDEX_DEREF(ITER); !BOOST_FOREACH_ID(_foreach_continue); BOOST_FOREACH_ID(_foreach_continue) = true)
+
+#define BOOST_FOREACH_PREFETCH_NEXT(ITER)                                                       \
+    boost::foreach_detail_::prefetch_next(                                                      \
+        BOOST_FOREACH_ID(_foreach_ahead)                                                        \
+      , BOOST_FOREACH_ID(_foreach_end)                                                          \
+      , ITER)
+
+// Like the classic BOOST_FOREACH loop, with a second iterator, _foreach_ahead,
+// that is advanced along with _foreach_cur.
+#define BOOST_FOREACH_PREFETCH_FOR(VAR, COL, DISTANCE, BEGIN, END, DONE, NEXT, DEREF, ITER)                       \
+    BOOST_FOREACH_PREAMBLE()                                                                                      \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_col) = BOOST_FOREACH_CONTAIN(COL)) {} else   \
+    BOOST_FOREACH_AUDIT_COPY(COL)                                                                                 \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_cur) = BEGIN(COL)) {} else                   \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_end) = END(COL)) {} else                     \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_ahead) = boost::foreach_detail_::prefetch_begin( \
+            BOOST_FOREACH_ID(_foreach_cur), BOOST_FOREACH_ID(_foreach_end), (DISTANCE), ITER)) {} else             \
+    for (bool BOOST_FOREACH_ID(_foreach_continue) = true;                                                         \
+              BOOST_FOREACH_ID(_foreach_continue) && !DONE(COL);                                                  \
+              BOOST_FOREACH_ID(_foreach_continue) ? (NEXT(COL), BOOST_FOREACH_PREFETCH_NEXT(ITER)) : (void)0)     \
+        if  (boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_continue))) {} else                      \
+        for (VAR = DEREF(COL); !BOOST_FOREACH_ID(_foreach_continue); BOOST_FOREACH_ID(_foreach_continue) = true)
+
+// BOOST_FOREACH_ZIP takes (VAR, COL)(VAR, COL)...; wrap each pair in a further
+// set of parentheses to make a sequence of tuples of Boost.Preprocessor.
+#define BOOST_FOREACH_ZIP_SEQ(SEQ)                                                              \
+    BOOST_PP_CAT(BOOST_FOREACH_ZIP_SEQ_A SEQ, _END)
+#define BOOST_FOREACH_ZIP_SEQ_A(VAR, COL) ((VAR, COL)) BOOST_FOREACH_ZIP_SEQ_B
+#define BOOST_FOREACH_ZIP_SEQ_B(VAR, COL) ((VAR, COL)) BOOST_FOREACH_ZIP_SEQ_A
+#define BOOST_FOREACH_ZIP_SEQ_A_END
+#define BOOST_FOREACH_ZIP_SEQ_B_END
+
+// The hidden variables of the I-th collection
+#define BOOST_FOREACH_ZIP_ID(NAME, I)                                                           \
+    BOOST_FOREACH_ID(BOOST_PP_CAT(NAME, BOOST_PP_CAT(I, _)))
+
+#define BOOST_FOREACH_ZIP_COL(ELEM) BOOST_PP_TUPLE_ELEM(2, 1, ELEM)
+
+#define BOOST_FOREACH_ZIP_ITERATOR_TYPE(ELEM)                                                   \
+    BOOST_FOREACH_ITERATOR_TYPE(BOOST_FOREACH_ZIP_COL(ELEM))
+
+// mpl::true_ * if every collection is random-access, and mpl::false_ * otherwise
+#define BOOST_FOREACH_ZIP_RANDOM_ACCESS(SEQ)                                                    \
+    static_cast<boost::mpl::bool_<0 != (1 BOOST_PP_SEQ_FOR_EACH_I(BOOST_FOREACH_ZIP_CATEGORY, ~, SEQ))> *>(0)
+
+#define BOOST_FOREACH_ZIP_CATEGORY(R, DATA, I, ELEM)                                            \
+    & sizeof(boost::foreach_detail_::zip_category(BOOST_FOREACH_ZIP_ITERATOR_TYPE(ELEM)))
+
+// Each collection is contained and its iterators found before the next is
+// evaluated, so each may have its own preamble.
+#define BOOST_FOREACH_ZIP_CONTAIN(R, DATA, I, ELEM)                                             \
+    BOOST_FOREACH_PREAMBLE()                                                                    \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ZIP_ID(_foreach_col, I) =              \
+            BOOST_FOREACH_CONTAIN(BOOST_FOREACH_ZIP_COL(ELEM))) {} else                         \
+    BOOST_FOREACH_AUDIT_COPY(BOOST_FOREACH_ZIP_COL(ELEM))                                       \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ZIP_ID(_foreach_cur, I) =              \
+            boost::foreach_detail_::begin(                                                      \
+                BOOST_FOREACH_ZIP_ID(_foreach_col, I)                                           \
+              , BOOST_FOREACH_TYPEOF(BOOST_FOREACH_ZIP_COL(ELEM))                               \
+              , BOOST_FOREACH_SHOULD_COPY(BOOST_FOREACH_ZIP_COL(ELEM)))) {} else                \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ZIP_ID(_foreach_end, I) =              \
+            boost::foreach_detail_::end(                                                        \
+                BOOST_FOREACH_ZIP_ID(_foreach_col, I)                                           \
+              , BOOST_FOREACH_TYPEOF(BOOST_FOREACH_ZIP_COL(ELEM))                               \
+              , BOOST_FOREACH_SHOULD_COPY(BOOST_FOREACH_ZIP_COL(ELEM)))) {} else
+
+#define BOOST_FOREACH_ZIP_LIMIT(R, RA, I, ELEM)                                                 \
+    if (boost::foreach_detail_::zip_limit(                                                      \
+            BOOST_FOREACH_ID(_foreach_zip)                                                      \
+          , BOOST_FOREACH_ZIP_ID(_foreach_cur, I)                                               \
+          , BOOST_FOREACH_ZIP_ID(_foreach_end, I)                                               \
+          , BOOST_FOREACH_ZIP_ITERATOR_TYPE(ELEM)                                               \
+          , RA)) {} else
+
+#define BOOST_FOREACH_ZIP_AT_END(R, RA, I, ELEM)                                                \
+    || boost::foreach_detail_::zip_at_end(                                                      \
+            BOOST_FOREACH_ZIP_ID(_foreach_cur, I)                                               \
+          , BOOST_FOREACH_ZIP_ID(_foreach_end, I)                                               \
+          , BOOST_FOREACH_ZIP_ITERATOR_TYPE(ELEM)                                               \
+          , RA)
+
+#define BOOST_FOREACH_ZIP_ADVANCE(R, RA, I, ELEM)                                               \
+    , boost::foreach_detail_::zip_advance(                                                      \
+            BOOST_FOREACH_ZIP_ID(_foreach_cur, I)                                               \
+          , BOOST_FOREACH_ZIP_ITERATOR_TYPE(ELEM)                                               \
+          , RA)
+
+#define BOOST_FOREACH_ZIP_DEREF(ELEM, I, RA)                                                    \
+    boost::foreach_detail_::zip_deref(                                                          \
+        BOOST_FOREACH_ID(_foreach_zip)                                                          \
+      , BOOST_FOREACH_ZIP_ID(_foreach_cur, I)                                                   \
+      , BOOST_FOREACH_ZIP_ITERATOR_TYPE(ELEM)                                                   \
+      , RA)
+
+#define BOOST_FOREACH_ZIP_DONE(SEQ, RA)                                                         \
+    (boost::foreach_detail_::zip_done(BOOST_FOREACH_ID(_foreach_zip), RA)                       \
+        BOOST_PP_SEQ_FOR_EACH_I(BOOST_FOREACH_ZIP_AT_END, RA, SEQ))
+
+#define BOOST_FOREACH_ZIP_NEXT(SEQ, RA)                                                         \
+    (boost::foreach_detail_::zip_next(BOOST_FOREACH_ID(_foreach_zip), RA)                       \
+        BOOST_PP_SEQ_FOR_EACH_I(BOOST_FOREACH_ZIP_ADVANCE, RA, SEQ))
+
+#define BOOST_FOREACH_ZIP_BEGIN(SEQ, RA)                                                                          \
+    BOOST_PP_SEQ_FOR_EACH_I(BOOST_FOREACH_ZIP_CONTAIN, ~, SEQ)                                                    \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_zip) = boost::foreach_detail_::zip_begin()) {} else \
+    BOOST_PP_SEQ_FOR_EACH_I(BOOST_FOREACH_ZIP_LIMIT, RA, SEQ)
+
+#if !defined(BOOST_FOREACH_NO_RANGE_BASED_FOR) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+
+// The loop variables are declared in the init-statements of ifs, so break and
+// continue in the loop body apply directly to the loop, which compilers can
+// then vectorize whatever the number of collections.
+#define BOOST_FOREACH_ZIP_VAR(R, RA, I, ELEM)                                                   \
+    if (BOOST_PP_TUPLE_ELEM(2, 0, ELEM) = BOOST_FOREACH_ZIP_DEREF(ELEM, I, RA); false) {} else
+
+#define BOOST_FOREACH_ZIP_FOR(SEQ, RA)                                                                            \
+    BOOST_FOREACH_ZIP_BEGIN(SEQ, RA)                                                                              \
+    for (; !BOOST_FOREACH_ZIP_DONE(SEQ, RA); BOOST_FOREACH_ZIP_NEXT(SEQ, RA))                                     \
+        BOOST_PP_SEQ_FOR_EACH_I(BOOST_FOREACH_ZIP_VAR, RA, SEQ)
+
+#else
+
+// All the loop variables but the last are declared by loops that share
+// _foreach_zip_set, as BOOST_FOREACH_INDEXED declares its index; the last is
+// declared as BOOST_FOREACH declares its loop variable.
+#define BOOST_FOREACH_ZIP_VAR(R, LAST_RA, I, ELEM)                                              \
+    BOOST_PP_IIF(BOOST_PP_EQUAL(I, BOOST_PP_TUPLE_ELEM(2, 0, LAST_RA)),                         \
+                 BOOST_FOREACH_ZIP_LAST_VAR, BOOST_FOREACH_ZIP_OTHER_VAR)                       \
+        (BOOST_PP_TUPLE_ELEM(2, 0, ELEM), BOOST_FOREACH_ZIP_DEREF(ELEM, I, BOOST_PP_TUPLE_ELEM(2, 1, LAST_RA)))
+
+#define BOOST_FOREACH_ZIP_OTHER_VAR(VAR, DEREF)                                                 \
+    for (VAR = DEREF; !BOOST_FOREACH_ID(_foreach_zip_set); BOOST_FOREACH_ID(_foreach_zip_set) = true)
+
+#define BOOST_FOREACH_ZIP_LAST_VAR(VAR, DEREF)                                                  \
+    for (VAR = DEREF; !BOOST_FOREACH_ID(_foreach_continue); BOOST_FOREACH_ID(_foreach_continue) = true)
+
+#define BOOST_FOREACH_ZIP_FOR(SEQ, RA)                                                                            \
+    BOOST_FOREACH_ZIP_BEGIN(SEQ, RA)                                                                              \
+    if (bool BOOST_FOREACH_ID(_foreach_zip_set) = false) {} else                                                  \
+    for (bool BOOST_FOREACH_ID(_foreach_continue) = true;                                                         \
+              BOOST_FOREACH_ID(_foreach_continue) && !BOOST_FOREACH_ZIP_DONE(SEQ, RA);                            \
+              BOOST_FOREACH_ID(_foreach_continue) ? BOOST_FOREACH_ZIP_NEXT(SEQ, RA) : (void)0)                    \
+        if  (boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_continue)) ||                            \
+             boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_zip_set))) {} else                       \
+        BOOST_PP_SEQ_FOR_EACH_I(BOOST_FOREACH_ZIP_VAR, (BOOST_PP_DEC(BOOST_PP_SEQ_SIZE(SEQ)), RA), SEQ)
+
+#endif
+
+#ifndef BOOST_FOREACH_NO_RANGE_BASED_FOR
+
+#define BOOST_FOREACH_RANGE(COL)                                                                \
+    boost::foreach_detail_::make_native_range(                                                  \
+        BOOST_FOREACH_EVALUATE(COL)                                                             \
+      , BOOST_FOREACH_TYPEOF(COL)                                                               \
+      , BOOST_FOREACH_SHOULD_COPY(COL))
+
+#define BOOST_FOREACH_RRANGE(COL)                                                               \
+    boost::foreach_detail_::make_native_reverse_range(                                          \
+        BOOST_FOREACH_EVALUATE(COL)                                                             \
+      , BOOST_FOREACH_TYPEOF(COL)                                                               \
+      , BOOST_FOREACH_SHOULD_COPY(COL))
+
+// std::forward, spelled as a cast so that unoptimized builds do not call a function
+#define BOOST_FOREACH_FORWARD_REF()                                                             \
+    static_cast<decltype(BOOST_FOREACH_ID(_foreach_ref)) &&>(BOOST_FOREACH_ID(_foreach_ref))
+
+# ifndef BOOST_NO_CXX17_IF_CONSTEXPR
+// The loop variable is declared in the init-statement of an if, so break and
+// continue in the loop body apply directly to the range-based for.
+#  define BOOST_FOREACH_RANGE_FOR(VAR, RNG)                                                                     \
+    for (auto &&BOOST_FOREACH_ID(_foreach_ref) : RNG)                                                           \
+        if (VAR = BOOST_FOREACH_FORWARD_REF(); false) {} else
+# else
+// The range is declared first, so that it is constructed once and guarded by
+// reference.
+#  define BOOST_FOREACH_RANGE_FOR(VAR, RNG)                                                                     \
+    if (auto &&BOOST_FOREACH_ID(_foreach_rng) = RNG) {} else                                                    \
+    for (bool BOOST_FOREACH_ID(_foreach_continue) = true;                                                       \
+              BOOST_FOREACH_ID(_foreach_continue);                                                              \
+              BOOST_FOREACH_ID(_foreach_continue) = false)                                                      \
+    for (auto &&BOOST_FOREACH_ID(_foreach_ref) :                                                                \
+            boost::foreach_detail_::guard(BOOST_FOREACH_ID(_foreach_rng), BOOST_FOREACH_ID(_foreach_continue))) \
+        if  (boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_continue))) {} else                    \
+        for (VAR = BOOST_FOREACH_FORWARD_REF(); !BOOST_FOREACH_ID(_foreach_continue); BOOST_FOREACH_ID(_foreach_continue) = true)
+# endif
+
+// Nests a range-based for over the elements of each block of the range in one
+// over its blocks. The range is declared first, so that it is constructed once
+// and the loops refer to it.
+# ifndef BOOST_NO_CXX17_IF_CONSTEXPR
+#  define BOOST_FOREACH_SEGMENTED_RANGE_FOR(VAR, RNG)                                                           \
+    if (auto &&BOOST_FOREACH_ID(_foreach_rng) = RNG) {} else                                                    \
+    for (auto &&BOOST_FOREACH_ID(_foreach_seg) :                                                                \
+            boost::foreach_detail_::segments(BOOST_FOREACH_ID(_foreach_rng)))                                   \
+    for (auto &&BOOST_FOREACH_ID(_foreach_ref) : BOOST_FOREACH_ID(_foreach_seg))                                \
+        if (VAR = BOOST_FOREACH_FORWARD_REF(); false) {} else
+# else
+#  define BOOST_FOREACH_SEGMENTED_RANGE_FOR(VAR, RNG)                                                           \
+    if (auto &&BOOST_FOREACH_ID(_foreach_rng) = RNG) {} else                                                    \
+    for (bool BOOST_FOREACH_ID(_foreach_continue) = true;                                                       \
+              BOOST_FOREACH_ID(_foreach_continue);                                                              \
+              BOOST_FOREACH_ID(_foreach_continue) = false)                                                      \
+    for (auto &&BOOST_FOREACH_ID(_foreach_seg) :                                                                \
+            boost::foreach_detail_::guard(                                                                      \
+                boost::foreach_detail_::segments(BOOST_FOREACH_ID(_foreach_rng)),                               \
+                BOOST_FOREACH_ID(_foreach_continue)))                                                           \
+    for (auto &&BOOST_FOREACH_ID(_foreach_ref) :                                                                \
+            boost::foreach_detail_::guard(BOOST_FOREACH_ID(_foreach_seg), BOOST_FOREACH_ID(_foreach_continue))) \
+        if  (boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_continue))) {} else                    \
+        for (VAR = BOOST_FOREACH_FORWARD_REF(); !BOOST_FOREACH_ID(_foreach_continue); BOOST_FOREACH_ID(_foreach_continue) = true)
+# endif
+
+#endif
+
+// Define BOOST_FOREACH_PROFILE to have BOOST_FOREACH and BOOST_REVERSE_FOREACH
+// count and time the loops at each call site; see <boost/foreach_profile.hpp>.
+// The scope that records a loop is declared before it, and each iteration is
+// counted before the body runs.
+#ifdef BOOST_FOREACH_PROFILE
+# define BOOST_FOREACH_PROFILE_ENTER(COL)                                                       \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_profile) =                 \
+            boost::foreach_detail_::profile_enter(BOOST_FOREACH_TYPEOF(COL), __FILE__, __LINE__, []{})) {} else
+# define BOOST_FOREACH_PROFILE_TICK()                                                           \
+    if (boost::foreach_detail_::profile_tick(BOOST_FOREACH_ID(_foreach_profile))) {} else
+#else
+# define BOOST_FOREACH_PROFILE_ENTER(COL)
+# define BOOST_FOREACH_PROFILE_TICK()
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // BOOST_FOREACH
 //
@@ -1102,16 +4129,34 @@ rderef(auto_any_t cur, type2type<T, C> *)
 //   BOOST_FOREACH(i, int_list)
 //       { ... }
 //
+//   Where the compiler supports it, BOOST_FOREACH is lowered
+//   to a native range-based for loop.
+//
+#ifndef BOOST_FOREACH_NO_RANGE_BASED_FOR
+#define BOOST_FOREACH(VAR, COL)                                                                                   \
+    BOOST_FOREACH_PREAMBLE()                                                                                      \
+    BOOST_FOREACH_PROFILE_ENTER(COL)                                                                              \
+    BOOST_FOREACH_AUDIT_COPY(COL)                                                                                 \
+    BOOST_FOREACH_SEGMENTED_RANGE_FOR(VAR, BOOST_FOREACH_RANGE(COL))                                              \
+    BOOST_FOREACH_PROFILE_TICK()
+#else
 #define BOOST_FOREACH(VAR, COL)                                                                                   \
     BOOST_FOREACH_PREAMBLE()                                                                                      \
+    BOOST_FOREACH_PROFILE_ENTER(COL)                                                                              \
     if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_col) = BOOST_FOREACH_CONTAIN(COL)) {} else   \
+    BOOST_FOREACH_AUDIT_COPY(COL)                                                                                 \
     if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_cur) = BOOST_FOREACH_BEGIN(COL)) {} else     \
     if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_end) = BOOST_FOREACH_END(COL)) {} else       \
-    for (bool BOOST_FOREACH_ID(_foreach_continue) = true;                                                         \
-              BOOST_FOREACH_ID(_foreach_continue) && !BOOST_FOREACH_DONE(COL);                                    \
-              BOOST_FOREACH_ID(_foreach_continue) ? BOOST_FOREACH_NEXT(COL) : (void)0)                            \
+    for (bool BOOST_FOREACH_ID(_foreach_continue) = true,                                                         \
+              BOOST_FOREACH_ID(_foreach_more) = BOOST_FOREACH_SEGMENTS_BEGIN(COL);                                \
+              BOOST_FOREACH_ID(_foreach_continue) && BOOST_FOREACH_ID(_foreach_more);)                            \
+    if  (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_seg) = BOOST_FOREACH_SEGMENT(COL)) {} else  \
+    for (;    BOOST_FOREACH_ID(_foreach_continue) && !BOOST_FOREACH_SEGMENT_DONE(COL);                            \
+              BOOST_FOREACH_ID(_foreach_continue) ? BOOST_FOREACH_SEGMENT_NEXT(COL) : (void)0)                    \
         if  (boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_continue))) {} else                      \
-        for (VAR = BOOST_FOREACH_DEREF(COL); !BOOST_FOREACH_ID(_foreach_continue); BOOST_FOREACH_ID(_foreach_continue) = true)
+        for (VAR = BOOST_FOREACH_SEGMENT_DEREF(COL); !BOOST_FOREACH_ID(_foreach_continue); BOOST_FOREACH_ID(_foreach_continue) = true) \
+        BOOST_FOREACH_PROFILE_TICK()
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 // BOOST_REVERSE_FOREACH
@@ -1120,15 +4165,266 @@ rderef(auto_any_t cur, type2type<T, C> *)
 //   all other respects, BOOST_REVERSE_FOREACH is like
 //   BOOST_FOREACH.
 //
+#ifndef BOOST_FOREACH_NO_RANGE_BASED_FOR
+#define BOOST_REVERSE_FOREACH(VAR, COL)                                                                           \
+    BOOST_FOREACH_PREAMBLE()                                                                                      \
+    BOOST_FOREACH_PROFILE_ENTER(COL)                                                                              \
+    BOOST_FOREACH_AUDIT_COPY(COL)                                                                                 \
+    BOOST_FOREACH_RANGE_FOR(VAR, BOOST_FOREACH_RRANGE(COL))                                                       \
+    BOOST_FOREACH_PROFILE_TICK()
+#else
 #define BOOST_REVERSE_FOREACH(VAR, COL)                                                                           \
     BOOST_FOREACH_PREAMBLE()                                                                                      \
+    BOOST_FOREACH_PROFILE_ENTER(COL)                                                                              \
     if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_col) = BOOST_FOREACH_CONTAIN(COL)) {} else   \
+    BOOST_FOREACH_AUDIT_COPY(COL)                                                                                 \
     if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_cur) = BOOST_FOREACH_RBEGIN(COL)) {} else    \
     if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_end) = BOOST_FOREACH_REND(COL)) {} else      \
     for (bool BOOST_FOREACH_ID(_foreach_continue) = true;                                                         \
               BOOST_FOREACH_ID(_foreach_continue) && !BOOST_FOREACH_RDONE(COL);                                   \
               BOOST_FOREACH_ID(_foreach_continue) ? BOOST_FOREACH_RNEXT(COL) : (void)0)                           \
         if  (boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_continue))) {} else                      \
-        for (VAR = BOOST_FOREACH_RDEREF(COL); !BOOST_FOREACH_ID(_foreach_continue); BOOST_FOREACH_ID(_foreach_continue) = true)
+        for (VAR = BOOST_FOREACH_RDEREF(COL); !BOOST_FOREACH_ID(_foreach_continue); BOOST_FOREACH_ID(_foreach_continue) = true) \
+        BOOST_FOREACH_PROFILE_TICK()
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_FOREACH_CONSUME
+//
+//   Like BOOST_FOREACH, but when the loop owns the collection,
+//   because it is a non-const rvalue, its elements are yielded
+//   as rvalues, so that a loop variable taken by value is
+//   move-constructed from each rather than copied. For
+//   example:
+//
+//   BOOST_FOREACH_CONSUME(std::string name, make_names())
+//       names.push_back(std::move(name));   // no copies
+//
+//   std::move(v) consumes a named container v, leaving its
+//   elements moved-from. The elements of lvalues, of const
+//   rvalues, and of views and lightweight proxies, which
+//   belong to another collection, are yielded as BOOST_FOREACH
+//   yields them. Without C++11 rvalue references, and where
+//   rvalues are only detected at run time, BOOST_FOREACH_CONSUME
+//   is BOOST_FOREACH.
+//
+#if defined(BOOST_FOREACH_COMPILE_TIME_CONST_RVALUE_DETECTION)                                \
+ && !defined(BOOST_NO_CXX11_RVALUE_REFERENCES) && !defined(BOOST_NO_CXX11_DECLTYPE)
+#define BOOST_FOREACH_CONSUME(VAR, COL)                                                                           \
+    BOOST_FOREACH_PREAMBLE()                                                                                      \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_col) = BOOST_FOREACH_CONTAIN(COL)) {} else   \
+    BOOST_FOREACH_AUDIT_COPY(COL)                                                                                 \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_cur) = boost::foreach_detail_::begin(        \
+            BOOST_FOREACH_ID(_foreach_col), BOOST_FOREACH_CONSUME_TYPEOF(COL), BOOST_FOREACH_SHOULD_COPY(COL))) {} else \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_end) = boost::foreach_detail_::end(          \
+            BOOST_FOREACH_ID(_foreach_col), BOOST_FOREACH_CONSUME_TYPEOF(COL), BOOST_FOREACH_SHOULD_COPY(COL))) {} else \
+    for (bool BOOST_FOREACH_ID(_foreach_continue) = true;                                                         \
+              BOOST_FOREACH_ID(_foreach_continue) && !boost::foreach_detail_::done(                               \
+                  BOOST_FOREACH_ID(_foreach_cur), BOOST_FOREACH_ID(_foreach_end), BOOST_FOREACH_CONSUME_TYPEOF(COL)); \
+              BOOST_FOREACH_ID(_foreach_continue) ? boost::foreach_detail_::next(                                 \
+                  BOOST_FOREACH_ID(_foreach_cur), BOOST_FOREACH_CONSUME_TYPEOF(COL)) : (void)0)                   \
+        if  (boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_continue))) {} else                      \
+        for (VAR = boost::foreach_detail_::consume(                                                               \
+                  boost::foreach_detail_::deref(BOOST_FOREACH_ID(_foreach_cur), BOOST_FOREACH_CONSUME_TYPEOF(COL)) \
+                , BOOST_FOREACH_SHOULD_CONSUME(COL));                                                             \
+                  !BOOST_FOREACH_ID(_foreach_continue); BOOST_FOREACH_ID(_foreach_continue) = true)
+#else
+#define BOOST_FOREACH_CONSUME(VAR, COL)                                                                           \
+    BOOST_FOREACH(VAR, COL)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_FOREACH_INDEXED
+//
+//   Like BOOST_FOREACH, but also declares or assigns a
+//   std::size_t index that counts the elements visited.
+//   For example:
+//
+//   BOOST_FOREACH_INDEXED(std::size_t i, int &x, int_vector)
+//   {
+//       /* i is 0 for the first element, 1 for the next ... */
+//   }
+//
+//   Random-access collections are driven by the index
+//   alone. Others advance an iterator alongside it.
+//
+#define BOOST_FOREACH_INDEXED(IDX, VAR, COL)                                                                      \
+    BOOST_FOREACH_INDEXED_FOR(IDX, VAR, COL, BOOST_FOREACH_BEGIN, BOOST_FOREACH_END,                              \
+                              BOOST_FOREACH_ITERATOR_TYPE(COL))
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_REVERSE_FOREACH_INDEXED
+//
+//   BOOST_FOREACH_INDEXED in reverse order. The index
+//   still counts the elements visited, so it is 0 for the
+//   last element of the collection.
+//
+#define BOOST_REVERSE_FOREACH_INDEXED(IDX, VAR, COL)                                                              \
+    BOOST_FOREACH_INDEXED_FOR(IDX, VAR, COL, BOOST_FOREACH_RBEGIN, BOOST_FOREACH_REND,                            \
+                              BOOST_FOREACH_REVERSE_ITERATOR_TYPE(COL))
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_FOREACH_PREFETCH
+//
+//   BOOST_FOREACH, prefetching the element DISTANCE places
+//   ahead of the current one. For example:
+//
+//   BOOST_FOREACH_PREFETCH(order const &o, order_list, 8)
+//   {
+//       total += o.quantity;
+//   }
+//
+//   Meant for collections whose elements are scattered
+//   through memory, such as std::list and std::map, where
+//   the hardware prefetcher cannot predict the next access.
+//
+#define BOOST_FOREACH_PREFETCH(VAR, COL, DISTANCE)                                                                \
+    BOOST_FOREACH_PREFETCH_FOR(VAR, COL, DISTANCE, BOOST_FOREACH_BEGIN, BOOST_FOREACH_END, BOOST_FOREACH_DONE,     \
+                               BOOST_FOREACH_NEXT, BOOST_FOREACH_DEREF, BOOST_FOREACH_ITERATOR_TYPE(COL))
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_REVERSE_FOREACH_PREFETCH
+//
+//   BOOST_FOREACH_PREFETCH in reverse order.
+//
+#define BOOST_REVERSE_FOREACH_PREFETCH(VAR, COL, DISTANCE)                                                        \
+    BOOST_FOREACH_PREFETCH_FOR(VAR, COL, DISTANCE, BOOST_FOREACH_RBEGIN, BOOST_FOREACH_REND, BOOST_FOREACH_RDONE,  \
+                               BOOST_FOREACH_RNEXT, BOOST_FOREACH_RDEREF, BOOST_FOREACH_REVERSE_ITERATOR_TYPE(COL))
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_FOREACH_ZIP
+//
+//   Iterates over several collections in lock step, until
+//   the shortest is exhausted. For example:
+//
+//   BOOST_FOREACH_ZIP((double price, prices)(int size, sizes))
+//   {
+//       notional += price * size;
+//   }
+//
+//   When every collection is random-access, the loop tests
+//   a single index against the length of the shortest.
+//
+#define BOOST_FOREACH_ZIP(SEQ)                                                                                    \
+    BOOST_FOREACH_ZIP_I(BOOST_FOREACH_ZIP_SEQ(SEQ))
+
+#define BOOST_FOREACH_ZIP_I(SEQ)                                                                                  \
+    BOOST_FOREACH_ZIP_FOR(SEQ, BOOST_FOREACH_ZIP_RANDOM_ACCESS(SEQ))
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_FOREACH_KV
+//
+//   Iterates over a collection of std::pairs, such as a
+//   std::map, binding the members of each pair to their own
+//   loop variables. For example:
+//
+//   BOOST_FOREACH_KV(std::string const &name, int &count, counts)
+//   {
+//       std::cout << name << ": " << ++count << "\n";
+//   }
+//
+//   Declared as references, the key and the value refer to
+//   the members of the pair in the collection; nothing is
+//   copied.
+//
+#define BOOST_FOREACH_KV(KEY, VALUE, COL)                                                                         \
+    BOOST_FOREACH_PREAMBLE()                                                                                      \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_col) = BOOST_FOREACH_CONTAIN(COL)) {} else   \
+    BOOST_FOREACH_AUDIT_COPY(COL)                                                                                 \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_cur) = BOOST_FOREACH_BEGIN(COL)) {} else     \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_end) = BOOST_FOREACH_END(COL)) {} else       \
+    if (bool BOOST_FOREACH_ID(_foreach_key_set) = false) {} else                                                  \
+    for (bool BOOST_FOREACH_ID(_foreach_continue) = true;                                                         \
+              BOOST_FOREACH_ID(_foreach_continue) && !BOOST_FOREACH_DONE(COL);                                    \
+              BOOST_FOREACH_ID(_foreach_continue) ? BOOST_FOREACH_NEXT(COL) : (void)0)                            \
+        if  (boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_continue)) ||                            \
+             boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_key_set))) {} else                       \
+        for (KEY = boost::foreach_detail_::kv_key(BOOST_FOREACH_ID(_foreach_cur), BOOST_FOREACH_TYPEOF(COL));     \
+                  !BOOST_FOREACH_ID(_foreach_key_set); BOOST_FOREACH_ID(_foreach_key_set) = true)                 \
+        for (VALUE = boost::foreach_detail_::kv_value(BOOST_FOREACH_ID(_foreach_cur), BOOST_FOREACH_TYPEOF(COL)); \
+                  !BOOST_FOREACH_ID(_foreach_continue); BOOST_FOREACH_ID(_foreach_continue) = true)
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_FOREACH_CHUNK
+//
+//   Iterates over a collection in blocks of at most N
+//   elements, where N is a constant. For example:
+//
+//   BOOST_FOREACH_CHUNK(boost::foreach::chunk<float> c, float_vector, 8)
+//   {
+//       kernel(c.data(), c.size());
+//   }
+//
+//   Every chunk but the last has N elements. Chunks of
+//   collections iterated with pointers refer to the
+//   collection itself; other collections are copied, a
+//   chunk at a time, into a buffer on the stack.
+//
+#define BOOST_FOREACH_CHUNK(SPAN, COL, N)                                                                         \
+    BOOST_FOREACH_PREAMBLE()                                                                                      \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_col) = BOOST_FOREACH_CONTAIN(COL)) {} else   \
+    BOOST_FOREACH_AUDIT_COPY(COL)                                                                                 \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_cur) = BOOST_FOREACH_BEGIN(COL)) {} else     \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_end) = BOOST_FOREACH_END(COL)) {} else       \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_chunker) =                                   \
+            boost::foreach_detail_::chunk_begin<(N)>(BOOST_FOREACH_TYPEOF(COL))) {} else                          \
+    for (bool BOOST_FOREACH_ID(_foreach_continue) = true;                                                         \
+              BOOST_FOREACH_ID(_foreach_continue) && !BOOST_FOREACH_DONE(COL);)                                   \
+        if  (boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_continue))) {} else                      \
+        for (SPAN = boost::foreach_detail_::chunk_take<(N)>(                                                      \
+                        BOOST_FOREACH_ID(_foreach_chunker)                                                        \
+                      , BOOST_FOREACH_ID(_foreach_cur)                                                            \
+                      , BOOST_FOREACH_ID(_foreach_end)                                                            \
+                      , BOOST_FOREACH_TYPEOF(COL));                                                               \
+                  !BOOST_FOREACH_ID(_foreach_continue); BOOST_FOREACH_ID(_foreach_continue) = true)
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_FOREACH_UNROLLED
+//
+//   BOOST_FOREACH, with the loop unrolled K times, where K
+//   is an integer literal. For example:
+//
+//   BOOST_FOREACH_UNROLLED(float &f, float_vector, 4)
+//   {
+//       f *= 2;
+//   }
+//
+//   Loops over arrays, boost::array and std::array of at
+//   most BOOST_FOREACH_UNROLL_THRESHOLD elements are
+//   unrolled completely, whatever K is.
+//
+#define BOOST_FOREACH_UNROLLED(VAR, COL, K)                                                                       \
+    BOOST_FOREACH_PREAMBLE()                                                                                      \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_col) = BOOST_FOREACH_CONTAIN(COL)) {} else   \
+    BOOST_FOREACH_AUDIT_COPY(COL)                                                                                 \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_cur) = BOOST_FOREACH_BEGIN(COL)) {} else     \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_end) = BOOST_FOREACH_END(COL)) {} else       \
+    BOOST_FOREACH_PRAGMA_UNROLL(K)                                                                                \
+    for (bool BOOST_FOREACH_ID(_foreach_continue) = true, BOOST_FOREACH_ID(_foreach_more) = !BOOST_FOREACH_DONE(COL); \
+              BOOST_FOREACH_ID(_foreach_more);                                                                    \
+              BOOST_FOREACH_ID(_foreach_more) = boost::foreach_detail_::unroll_next(                              \
+                  BOOST_FOREACH_ID(_foreach_continue)                                                             \
+                , BOOST_FOREACH_ID(_foreach_cur)                                                                  \
+                , BOOST_FOREACH_ID(_foreach_end)                                                                  \
+                , BOOST_FOREACH_TYPEOF(COL)))                                                                     \
+    BOOST_FOREACH_PRAGMA_UNROLL(BOOST_FOREACH_UNROLL_THRESHOLD)                                                   \
+    for (std::size_t BOOST_FOREACH_ID(_foreach_i) = 0,                                                            \
+                     BOOST_FOREACH_ID(_foreach_n) = boost::foreach_detail_::unroll_block(BOOST_FOREACH_TYPEOF(COL)); \
+              BOOST_FOREACH_ID(_foreach_continue) & (BOOST_FOREACH_ID(_foreach_i) != BOOST_FOREACH_ID(_foreach_n));   \
+              ++BOOST_FOREACH_ID(_foreach_i))                                                                     \
+        if  (boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_continue))) {} else                      \
+        for (VAR = boost::foreach_detail_::unroll_deref(                                                          \
+                        BOOST_FOREACH_ID(_foreach_cur)                                                            \
+                      , BOOST_FOREACH_ID(_foreach_i)                                                              \
+                      , BOOST_FOREACH_TYPEOF(COL));                                                               \
+                  !BOOST_FOREACH_ID(_foreach_continue); BOOST_FOREACH_ID(_foreach_continue) = true)
+
+#ifdef BOOST_FOREACH_PROFILE
+# include <boost/foreach_profile.hpp>
+#endif
+
+#ifdef BOOST_FOREACH_AUDIT_COPIES
+# include <boost/foreach_audit.hpp>
+#endif
 
 #endif
@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+// foreach_audit.hpp header file
+//
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+// See http://www.boost.org/libs/foreach for documentation
+
+// With BOOST_FOREACH_AUDIT_COPIES defined, every loop that copies or moves its
+// collection into the loop, because the collection is an rvalue or a
+// lightweight proxy, reports it to a handler: the call site, the type of the
+// collection, its size, and why it was copied.
+//
+//   #define BOOST_FOREACH_AUDIT_COPIES
+//   #include <boost/foreach.hpp>
+//
+// By default the first copy of an rvalue at each call site is written to
+// std::clog; moves and copies of lightweight proxies, which are cheap, are not.
+// boost::foreach::audit::set_copy_handler() installs a handler that is told of
+// every one.
+
+#ifndef BOOST_FOREACH_AUDIT_HPP
+#define BOOST_FOREACH_AUDIT_HPP
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/config.hpp>
+
+#if defined(BOOST_NO_CXX11_LAMBDAS) || defined(BOOST_NO_CXX11_HDR_ATOMIC)                      \
+ || defined(BOOST_NO_CXX11_DECLTYPE) || defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+# error BOOST_FOREACH_AUDIT_COPIES requires C++11 lambdas, atomics and decltype
+#endif
+
+#include <boost/foreach.hpp>
+
+#if !defined(BOOST_FOREACH_CONTAIN)
+# error <boost/foreach_audit.hpp> needs <boost/foreach.hpp> without BOOST_FOREACH_LITE
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <ostream>
+#include <iostream>
+#include <boost/core/demangle.hpp>
+#include <boost/core/typeinfo.hpp>
+#include <boost/type_traits/is_lvalue_reference.hpp>
+
+namespace boost
+{
+
+namespace foreach
+{
+namespace audit
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // copy_record
+    //   A collection copied or moved into a loop. count is the number of times
+    //   the loop at this call site has done so, this time included.
+    struct copy_record
+    {
+        char const *file;
+        int line;
+        char const *type;   // the demangled name of the type, valid for the life of the program
+        std::size_t size;   // sizeof the collection
+        bool proxy;         // copied because it is a lightweight proxy, not because it is an rvalue
+        bool moved;         // moved rather than copied
+        unsigned long count;
+    };
+
+    typedef void (*copy_handler)(copy_record const &);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // write_copy
+    //   Writes a copy on one line:
+    //
+    //   main.cpp:42: BOOST_FOREACH copied a std::vector<int> (24 bytes), an rvalue
+    inline void write_copy(std::ostream &sout, copy_record const &copy)
+    {
+        sout << copy.file << ':' << copy.line << ": BOOST_FOREACH "
+             << (copy.moved ? "moved" : "copied") << " a " << copy.type
+             << " (" << copy.size << " bytes), "
+             << (copy.proxy ? "a lightweight proxy" : "an rvalue") << '\n';
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // default_copy_handler
+    //   Writes the first copy of an rvalue at each call site to std::clog.
+    inline void default_copy_handler(copy_record const &copy)
+    {
+        if(!copy.moved && !copy.proxy && 1 == copy.count)
+            audit::write_copy(std::clog, copy);
+    }
+} // namespace audit
+} // namespace foreach
+
+namespace foreach_detail_
+{
+
+inline std::atomic<foreach::audit::copy_handler> &copy_handler_()
+{
+    static std::atomic<foreach::audit::copy_handler> handler(&foreach::audit::default_copy_handler);
+    return handler;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// audit_copy
+//   Reports the copy, if the loop made one. Ref is the type of the collection
+//   expression: only a non-const rvalue is moved into the loop, and only where
+//   rvalues are detected at compile time. Site is the type of a lambda written
+//   at the call site, so that each call site counts its copies.
+template<typename T, typename C, typename IsProxy, typename Ref, typename Site>
+inline void audit_copy_(type2type<T, C> *, IsProxy *, boost::mpl::identity<Ref> *, char const *file, int line, Site)
+{
+    static std::atomic<unsigned long> count(0);
+    // demangled with malloc, so the audit does not disturb a count of
+    // the collection's own allocations
+    static boost::core::scoped_demangled_name const type(BOOST_CORE_TYPEID(T).name());
+    foreach::audit::copy_record copy;
+    copy.file = file;
+    copy.line = line;
+    copy.type = type.get() ? type.get() : BOOST_CORE_TYPEID(T).name();
+    copy.size = sizeof(T);
+    copy.proxy = IsProxy::value;
+#ifdef BOOST_FOREACH_COMPILE_TIME_CONST_RVALUE_DETECTION
+    copy.moved = !boost::is_lvalue_reference<Ref>::value
+              && !boost::is_const<BOOST_DEDUCED_TYPENAME boost::remove_reference<Ref>::type>::value;
+#else
+    copy.moved = false;
+#endif
+    copy.count = ++count;
+    if(foreach::audit::copy_handler handler = copy_handler_().load())
+        handler(copy);
+}
+
+template<typename T, typename C, typename IsProxy, typename Ref, typename Site>
+inline bool audit_copy(type2type<T, C> *col, boost::mpl::true_ *copy, IsProxy *proxy,
+                       boost::mpl::identity<Ref> *ref, char const *file, int line, Site site)
+{
+    foreach_detail_::check_copy(col, copy, proxy);
+    foreach_detail_::audit_copy_(col, proxy, ref, file, line, site);
+    return false;
+}
+
+template<typename T, typename C, typename IsProxy, typename Ref, typename Site>
+inline bool audit_copy(type2type<T, C> *, boost::mpl::false_ *, IsProxy *,
+                       boost::mpl::identity<Ref> *, char const *, int, Site)
+{
+    return false;
+}
+
+template<typename T, typename C, typename IsProxy, typename Ref, typename Site>
+inline bool audit_copy(type2type<T, C> *col, bool *is_rvalue, IsProxy *proxy,
+                       boost::mpl::identity<Ref> *ref, char const *file, int line, Site site)
+{
+    if(*is_rvalue)
+        foreach_detail_::audit_copy_(col, proxy, ref, file, line, site);
+    return false;
+}
+
+} // namespace foreach_detail_
+
+namespace foreach
+{
+namespace audit
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // set_copy_handler
+    //   Has the loops that start afterwards report their copies to handler, on
+    //   the thread that runs the loop, and returns the handler it replaces. A
+    //   null handler turns the reports off.
+    inline copy_handler set_copy_handler(copy_handler handler)
+    {
+        return foreach_detail_::copy_handler_().exchange(handler);
+    }
+} // namespace audit
+} // namespace foreach
+
+} // namespace boost
+
+#endif
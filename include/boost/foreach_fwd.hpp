@@ -44,6 +44,28 @@ namespace foreach
     template<typename T>
     struct is_noncopyable;
 
+    ///////////////////////////////////////////////////////////////////////////////
+    // boost::foreach::is_contiguous
+    //   Specialize this for user-defined collection types whose elements are stored
+    //   contiguously, or as false for types that are detected as contiguous but are not.
+    template<typename T>
+    struct is_contiguous;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // boost::foreach::has_sentinel
+    //   Specialize this as false for user-defined collection types whose end() is
+    //   detected as returning a sentinel but should be iterated as a Boost.Range,
+    //   or as true for those whose sentinel is not detected.
+    template<typename T>
+    struct has_sentinel;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // boost::foreach::segmented_iterator
+    //   Specialize this for the iterators of user-defined collection types that
+    //   store their elements in a sequence of contiguous blocks.
+    template<typename Iter>
+    struct segmented_iterator;
+
 } // namespace foreach
 
 } // namespace boost
@@ -0,0 +1,592 @@
+///////////////////////////////////////////////////////////////////////////////
+// foreach_lite.hpp header file
+//
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+// See http://www.boost.org/libs/foreach for documentation
+//
+// A lighter BOOST_FOREACH for C++11 and later. It expands to the same native
+// range-based for loop as <boost/foreach.hpp> but depends only on the
+// standard library, so each loop takes about half as long to compile; the
+// #include itself costs only a little less. It is used by <boost/foreach.hpp>
+// itself when BOOST_FOREACH_LITE is defined.
+//
+// BOOST_FOREACH_LITE is meant to be defined per translation unit. It leaves
+// <boost/foreach.hpp> with BOOST_FOREACH, BOOST_REVERSE_FOREACH,
+// BOOST_FOREACH_INDEXED and BOOST_FOREACH_CONSUME only: BOOST_FOREACH_KV,
+// BOOST_FOREACH_ZIP, BOOST_FOREACH_CHUNK, BOOST_FOREACH_PREFETCH,
+// BOOST_FOREACH_UNROLLED, irange() and boost::foreach::chunk are gone, and
+// <boost/foreach_parallel.hpp>, <boost/foreach_set_bit.hpp>,
+// <boost/foreach_profile.hpp> and <boost/foreach_audit.hpp> stop with an
+// #error. Defined project-wide, it breaks every file that uses them.
+//
+// It iterates over everything Boost.Range can: STL containers, arrays,
+// std::pair of iterators, types with begin() and end() members and types
+// that extend Boost.Range with range_begin() and range_end() overloads. As
+// with <boost/foreach.hpp>, pointers to char and wchar_t are null-terminated
+// strings. Collections are never copied: rvalues are moved into the loop and
+// lvalues are used in place, so is_lightweight_proxy and is_noncopyable have
+// no effect. Before C++11 this header falls back to <boost/foreach.hpp>.
+
+#ifndef BOOST_FOREACH
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#if __cplusplus < 201103L && (!defined(_MSVC_LANG) || _MSVC_LANG < 201103L)
+
+# define BOOST_FOREACH_LITE_UNSUPPORTED
+# include <boost/foreach.hpp>
+
+#else
+
+#include <cstddef>
+#include <utility>      // for std::pair, std::forward
+#include <iterator>     // for std::begin, std::end, std::reverse_iterator, std::move_iterator
+#include <type_traits>
+#include <boost/foreach_fwd.hpp>
+
+// See BOOST_FOREACH_DEBUG_FAST in foreach.hpp
+#if !defined(BOOST_FOREACH_DEBUG_FAST)
+# define BOOST_FOREACH_LITE_DEBUG_INLINE inline
+#elif defined(_MSC_VER)
+# define BOOST_FOREACH_LITE_DEBUG_INLINE __forceinline
+#elif defined(__GNUC__)
+# define BOOST_FOREACH_LITE_DEBUG_INLINE inline __attribute__((__always_inline__))
+#else
+# define BOOST_FOREACH_LITE_DEBUG_INLINE inline
+#endif
+
+namespace boost
+{
+
+namespace foreach_lite_detail_
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// rank_
+//   Overloads taking a higher rank_ are preferred.
+template<int N>
+struct rank_ : rank_<N - 1> {};
+
+template<>
+struct rank_<0> {};
+
+template<typename T>
+struct is_char
+  : std::integral_constant<bool,
+        std::is_same<typename std::remove_cv<T>::type, char>::value
+     || std::is_same<typename std::remove_cv<T>::type, wchar_t>::value>
+{
+};
+
+template<typename Char>
+inline Char *cstr_end(Char *p)
+{
+    while(*p)
+        ++p;
+    return p;
+}
+
+#if defined(__GNUC__)
+inline char *cstr_end(char *p)
+{
+    return p + __builtin_strlen(p);
+}
+
+inline char const *cstr_end(char const *p)
+{
+    return p + __builtin_strlen(p);
+}
+#endif
+
+namespace adl_
+{
+    using std::begin;
+    using std::end;
+
+    template<typename T>
+    inline auto adl_begin(T &t) -> decltype(begin(t))
+    {
+        return begin(t);
+    }
+
+    template<typename T>
+    inline auto adl_end(T &t) -> decltype(end(t))
+    {
+        return end(t);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// col_begin/col_end
+//   Boost.Range extensions first, then iterator pairs and null-terminated
+//   strings, then anything std::begin and std::end accept.
+template<typename T>
+inline auto col_begin(T &t, rank_<2>) -> decltype(range_begin(t))
+{
+    return range_begin(t);
+}
+
+template<typename T>
+inline auto col_end(T &t, rank_<2>) -> decltype(range_end(t))
+{
+    return range_end(t);
+}
+
+template<typename Iterator>
+inline Iterator col_begin(std::pair<Iterator, Iterator> const &p, rank_<1>)
+{
+    return p.first;
+}
+
+template<typename Iterator>
+inline Iterator col_end(std::pair<Iterator, Iterator> const &p, rank_<1>)
+{
+    return p.second;
+}
+
+template<typename T>
+inline typename std::enable_if<is_char<T>::value, T *>::type
+col_begin(T *const &p, rank_<1>)
+{
+    return p;
+}
+
+template<typename T>
+inline typename std::enable_if<is_char<T>::value, T *>::type
+col_end(T *const &p, rank_<1>)
+{
+    return cstr_end(p);
+}
+
+template<typename T>
+inline auto col_begin(T &t, rank_<0>) -> decltype(adl_::adl_begin(t))
+{
+    return adl_::adl_begin(t);
+}
+
+template<typename T>
+inline auto col_end(T &t, rank_<0>) -> decltype(adl_::adl_end(t))
+{
+    return adl_::adl_end(t);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// range_base
+//   The ranges evaluate to false in boolean context, so that they can be
+//   declared in if() statements. See native_range_base in foreach.hpp.
+struct range_base
+{
+    BOOST_FOREACH_LITE_DEBUG_INLINE operator bool() const
+    {
+        return false;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// range/reverse_range
+//   C is a reference for lvalue collections, which are used in place, and a
+//   value type for rvalues, which are moved into the range.
+template<typename C>
+struct range
+  : range_base
+{
+    typedef decltype(col_begin(std::declval<C &>(), rank_<2>())) iterator;
+
+    explicit range(C &&c)
+      : col(std::forward<C>(c))
+    {
+    }
+
+    iterator begin()
+    {
+        return col_begin(this->col, rank_<2>());
+    }
+
+    iterator end()
+    {
+        return col_end(this->col, rank_<2>());
+    }
+
+private:
+    C col;
+};
+
+template<typename C>
+struct reverse_range
+  : range_base
+{
+    typedef std::reverse_iterator<
+        decltype(col_begin(std::declval<C &>(), rank_<2>()))
+    > iterator;
+
+    explicit reverse_range(C &&c)
+      : col(std::forward<C>(c))
+    {
+    }
+
+    iterator begin()
+    {
+        return iterator(col_end(this->col, rank_<2>()));
+    }
+
+    iterator end()
+    {
+        return iterator(col_begin(this->col, rank_<2>()));
+    }
+
+private:
+    C col;
+};
+
+template<typename C>
+inline range<C> make_range(C &&c)
+{
+    return range<C>(std::forward<C>(c));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// consume_range
+//   The elements of a collection that BOOST_FOREACH_CONSUME consumes, as
+//   rvalues. It consumes a non-const rvalue whose elements are its own: those
+//   of a container, which are lvalues made const by a const container, and not
+//   those of a view. See should_consume in foreach.hpp.
+template<typename C>
+inline auto const_deref_(rank_<1>) -> decltype(*col_begin(std::declval<C const &>(), rank_<2>()));
+
+template<typename C>
+inline void const_deref_(rank_<0>);
+
+template<typename C>
+struct owns_elements
+{
+    typedef decltype(*col_begin(std::declval<C &>(), rank_<2>())) reference;
+    typedef decltype(const_deref_<C>(rank_<1>())) const_reference;
+
+    static bool const value =
+        !std::is_reference<C>::value && !std::is_const<C>::value
+     && std::is_lvalue_reference<reference>::value
+     && !std::is_void<const_reference>::value
+     && !std::is_same<reference, const_reference>::value;
+};
+
+template<typename C>
+struct consume_range
+  : range_base
+{
+    typedef std::move_iterator<typename range<C>::iterator> iterator;
+
+    explicit consume_range(C &&c)
+      : rng(std::forward<C>(c))
+    {
+    }
+
+    iterator begin()
+    {
+        return iterator(this->rng.begin());
+    }
+
+    iterator end()
+    {
+        return iterator(this->rng.end());
+    }
+
+private:
+    range<C> rng;
+};
+
+template<typename C>
+inline typename std::conditional<owns_elements<C>::value, consume_range<C>, range<C> >::type
+make_consume_range(C &&c)
+{
+    typedef typename std::conditional<owns_elements<C>::value, consume_range<C>, range<C> >::type result_type;
+    return result_type(std::forward<C>(c));
+}
+
+template<typename C>
+inline reverse_range<C> make_reverse_range(C &&c)
+{
+    return reverse_range<C>(std::forward<C>(c));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// indexed_cursor
+//   The state of BOOST_FOREACH_INDEXED. Random-access ranges are walked by the
+//   index alone, others advance an iterator in step with it. See foreach.hpp.
+template<typename Iterator>
+struct is_random_access
+  : std::is_base_of<
+        std::random_access_iterator_tag
+      , typename std::iterator_traits<Iterator>::iterator_category
+    >
+{
+};
+
+template<typename Range, bool RandomAccess = is_random_access<typename Range::iterator>::value>
+struct indexed_cursor
+{
+    typedef typename Range::iterator iterator;
+
+    explicit indexed_cursor(Range &&r)
+      : rng(std::move(r))
+      , cur(this->rng.begin())
+      , end(this->rng.end())
+      , index(0)
+      , cont(true)
+      , index_set(false)
+    {
+    }
+
+    BOOST_FOREACH_LITE_DEBUG_INLINE bool done() const
+    {
+        return !this->cont || this->cur == this->end;
+    }
+
+    BOOST_FOREACH_LITE_DEBUG_INLINE void next()
+    {
+        if(this->cont)
+        {
+            ++this->index;
+            ++this->cur;
+        }
+    }
+
+    BOOST_FOREACH_LITE_DEBUG_INLINE decltype(*std::declval<iterator const &>()) deref() const
+    {
+        return *this->cur;
+    }
+
+    BOOST_FOREACH_LITE_DEBUG_INLINE bool enter()
+    {
+        this->cont = this->index_set = false;
+        return false;
+    }
+
+    Range rng;
+    iterator cur;
+    iterator end;
+    std::size_t index;
+    bool cont;
+    bool index_set;
+};
+
+template<typename Range>
+struct indexed_cursor<Range, true>
+{
+    typedef typename Range::iterator iterator;
+    typedef typename std::iterator_traits<iterator>::difference_type difference_type;
+
+    explicit indexed_cursor(Range &&r)
+      : rng(std::move(r))
+      , begin(this->rng.begin())
+      , size(static_cast<std::size_t>(this->rng.end() - this->begin))
+      , index(0)
+      , cont(true)
+      , index_set(false)
+    {
+    }
+
+    BOOST_FOREACH_LITE_DEBUG_INLINE bool done() const
+    {
+        return !this->cont || this->index == this->size;
+    }
+
+    BOOST_FOREACH_LITE_DEBUG_INLINE void next()
+    {
+        if(this->cont)
+            ++this->index;
+    }
+
+    BOOST_FOREACH_LITE_DEBUG_INLINE decltype(*std::declval<iterator const &>()) deref() const
+    {
+        return *(this->begin + static_cast<difference_type>(this->index));
+    }
+
+    BOOST_FOREACH_LITE_DEBUG_INLINE bool enter()
+    {
+        this->cont = this->index_set = false;
+        return false;
+    }
+
+    Range rng;
+    iterator begin;
+    std::size_t size;
+    std::size_t index;
+    bool cont;
+    bool index_set;
+};
+
+#if __cplusplus < 201703L && (!defined(_MSVC_LANG) || _MSVC_LANG < 201703L)
+///////////////////////////////////////////////////////////////////////////////
+// guarded_range
+//   Stops the range-based for when the loop body breaks, without advancing
+//   the iterator past the element it broke on. The range is guarded by
+//   reference. See foreach.hpp.
+template<typename Iterator>
+struct guarded_iterator
+{
+    guarded_iterator(Iterator it, bool const &cont)
+      : it(it)
+      , cont(&cont)
+    {
+    }
+
+    BOOST_FOREACH_LITE_DEBUG_INLINE decltype(*std::declval<Iterator const &>()) operator *() const
+    {
+        return *this->it;
+    }
+
+    BOOST_FOREACH_LITE_DEBUG_INLINE guarded_iterator &operator ++()
+    {
+        if(*this->cont)
+            ++this->it;
+        return *this;
+    }
+
+    BOOST_FOREACH_LITE_DEBUG_INLINE bool operator !=(guarded_iterator const &that) const
+    {
+        return *this->cont && this->it != that.it;
+    }
+
+private:
+    Iterator it;
+    bool const *cont;
+};
+
+template<typename Range>
+struct guarded_range
+{
+    typedef guarded_iterator<typename Range::iterator> iterator;
+
+    guarded_range(Range &rng, bool const &cont)
+      : rng(rng)
+      , cont(cont)
+    {
+    }
+
+    iterator begin()
+    {
+        return iterator(this->rng.begin(), this->cont);
+    }
+
+    iterator end()
+    {
+        return iterator(this->rng.end(), this->cont);
+    }
+
+private:
+    Range &rng;
+    bool const &cont;
+};
+
+template<typename Range>
+inline guarded_range<Range> guard(Range &rng, bool const &cont)
+{
+    return guarded_range<Range>(rng, cont);
+}
+
+BOOST_FOREACH_LITE_DEBUG_INLINE bool set_false(bool &b)
+{
+    b = false;
+    return false;
+}
+#endif
+
+} // namespace foreach_lite_detail_
+} // namespace boost
+
+#if defined(_MSC_VER) && !defined(__clang__) && _MSC_VER < 1600
+# define BOOST_FOREACH_LITE_ID(x) x
+#else
+# define BOOST_FOREACH_LITE_CAT(x, y) BOOST_FOREACH_LITE_CAT_I(x, y)
+# define BOOST_FOREACH_LITE_CAT_I(x, y) x ## y
+# define BOOST_FOREACH_LITE_ID(x) BOOST_FOREACH_LITE_CAT(x, __LINE__)
+#endif
+
+// std::forward, spelled as a cast so that unoptimized builds do not call a function
+#define BOOST_FOREACH_LITE_FORWARD_REF()                                                        \
+    static_cast<decltype(BOOST_FOREACH_LITE_ID(_foreach_ref)) &&>(BOOST_FOREACH_LITE_ID(_foreach_ref))
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+# define BOOST_FOREACH_LITE_RANGE_FOR(VAR, RNG)                                                                 \
+    for (auto &&BOOST_FOREACH_LITE_ID(_foreach_ref) : RNG)                                                      \
+        if (VAR = BOOST_FOREACH_LITE_FORWARD_REF(); false) {} else
+#else
+// The range is declared first, so that it is constructed once and guarded by
+// reference.
+# define BOOST_FOREACH_LITE_RANGE_FOR(VAR, RNG)                                                                 \
+    if (auto &&BOOST_FOREACH_LITE_ID(_foreach_rng) = RNG) {} else                                               \
+    for (bool BOOST_FOREACH_LITE_ID(_foreach_continue) = true;                                                  \
+              BOOST_FOREACH_LITE_ID(_foreach_continue);                                                         \
+              BOOST_FOREACH_LITE_ID(_foreach_continue) = false)                                                 \
+    for (auto &&BOOST_FOREACH_LITE_ID(_foreach_ref) :                                                           \
+            boost::foreach_lite_detail_::guard(BOOST_FOREACH_LITE_ID(_foreach_rng),                             \
+                                               BOOST_FOREACH_LITE_ID(_foreach_continue)))                       \
+        if  (boost::foreach_lite_detail_::set_false(BOOST_FOREACH_LITE_ID(_foreach_continue))) {} else          \
+        for (VAR = BOOST_FOREACH_LITE_FORWARD_REF();                                                            \
+                  !BOOST_FOREACH_LITE_ID(_foreach_continue);                                                    \
+                  BOOST_FOREACH_LITE_ID(_foreach_continue) = true)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_FOREACH
+//
+//   See foreach.hpp.
+//
+#define BOOST_FOREACH(VAR, COL)                                                                 \
+    BOOST_FOREACH_LITE_RANGE_FOR(VAR, boost::foreach_lite_detail_::make_range(COL))
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_REVERSE_FOREACH
+//
+//   See foreach.hpp.
+//
+#define BOOST_REVERSE_FOREACH(VAR, COL)                                                         \
+    BOOST_FOREACH_LITE_RANGE_FOR(VAR, boost::foreach_lite_detail_::make_reverse_range(COL))
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_FOREACH_CONSUME
+//
+//   See foreach.hpp.
+//
+#define BOOST_FOREACH_CONSUME(VAR, COL)                                                         \
+    BOOST_FOREACH_LITE_RANGE_FOR(VAR, boost::foreach_lite_detail_::make_consume_range(COL))
+
+// The cursor is declared in place, rather than returned from a function, because
+// it holds both an rvalue collection and iterators into it.
+#define BOOST_FOREACH_LITE_INDEXED_FOR(IDX, VAR, RNG)                                                           \
+    for (boost::foreach_lite_detail_::indexed_cursor<decltype(RNG)> BOOST_FOREACH_LITE_ID(_foreach_cur)(RNG);   \
+              !BOOST_FOREACH_LITE_ID(_foreach_cur).done();                                                      \
+              BOOST_FOREACH_LITE_ID(_foreach_cur).next())                                                       \
+        if  (BOOST_FOREACH_LITE_ID(_foreach_cur).enter()) {} else                                               \
+        for (IDX = BOOST_FOREACH_LITE_ID(_foreach_cur).index;                                                   \
+                  !BOOST_FOREACH_LITE_ID(_foreach_cur).index_set;                                               \
+                  BOOST_FOREACH_LITE_ID(_foreach_cur).index_set = true)                                         \
+        for (VAR = BOOST_FOREACH_LITE_ID(_foreach_cur).deref();                                                 \
+                  !BOOST_FOREACH_LITE_ID(_foreach_cur).cont;                                                    \
+                  BOOST_FOREACH_LITE_ID(_foreach_cur).cont = true)
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_FOREACH_INDEXED
+//
+//   See foreach.hpp.
+//
+#define BOOST_FOREACH_INDEXED(IDX, VAR, COL)                                                    \
+    BOOST_FOREACH_LITE_INDEXED_FOR(IDX, VAR, boost::foreach_lite_detail_::make_range(COL))
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_REVERSE_FOREACH_INDEXED
+//
+//   See foreach.hpp.
+//
+#define BOOST_REVERSE_FOREACH_INDEXED(IDX, VAR, COL)                                            \
+    BOOST_FOREACH_LITE_INDEXED_FOR(IDX, VAR, boost::foreach_lite_detail_::make_reverse_range(COL))
+
+#endif
+
+#endif
@@ -0,0 +1,443 @@
+///////////////////////////////////////////////////////////////////////////////
+// foreach_parallel.hpp header file
+//
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+// See http://www.boost.org/libs/foreach for documentation
+
+// BOOST_PARALLEL_FOREACH runs the body of the loop on a pool of threads. The
+// collection is evaluated exactly as BOOST_FOREACH evaluates it, and must have
+// random-access iterators. The body becomes the body of a lambda, so the
+// statement ends in a semicolon, and break and continue have no meaning
+// inside it; return skips to the next element.
+//
+//   BOOST_PARALLEL_FOREACH(Item &item, items)
+//   {
+//       item.update();
+//   };
+
+#ifndef BOOST_FOREACH_PARALLEL_HPP
+#define BOOST_FOREACH_PARALLEL_HPP
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/config.hpp>
+
+#if defined(BOOST_NO_CXX11_LAMBDAS) || defined(BOOST_NO_CXX11_HDR_THREAD)                      \
+ || defined(BOOST_NO_CXX11_HDR_MUTEX) || defined(BOOST_NO_CXX11_HDR_CONDITION_VARIABLE)         \
+ || defined(BOOST_NO_CXX11_HDR_ATOMIC) || defined(BOOST_NO_CXX11_THREAD_LOCAL)                  \
+ || defined(BOOST_NO_CXX11_RVALUE_REFERENCES) || defined(BOOST_NO_EXCEPTIONS)
+# error BOOST_PARALLEL_FOREACH requires C++11 lambdas, threads and exceptions
+#endif
+
+#include <boost/foreach.hpp>
+
+#if !defined(BOOST_FOREACH_CONTAIN)
+# error <boost/foreach_parallel.hpp> needs <boost/foreach.hpp> without BOOST_FOREACH_LITE
+#endif
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <exception>
+#include <system_error>
+#include <condition_variable>
+#include <boost/mpl/assert.hpp>
+#include <boost/align/aligned_allocator.hpp>
+
+namespace boost
+{
+
+namespace foreach_detail_
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// parallel_concurrency_
+//   The number of threads BOOST_PARALLEL_FOREACH uses, 0 for the default.
+inline std::atomic<unsigned> &parallel_concurrency_()
+{
+    static std::atomic<unsigned> concurrency(0u);
+    return concurrency;
+}
+
+} // namespace foreach_detail_
+
+namespace foreach
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // parallel_concurrency
+    //   The number of threads BOOST_PARALLEL_FOREACH runs its loops on, the
+    //   calling thread included. Defaults to std::thread::hardware_concurrency().
+    inline unsigned parallel_concurrency()
+    {
+        unsigned const concurrency = foreach_detail_::parallel_concurrency_().load();
+        unsigned const hardware = std::thread::hardware_concurrency();
+        return 0 != concurrency ? concurrency : 0 != hardware ? hardware : 1u;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // set_parallel_concurrency
+    //   Sets the number of threads BOOST_PARALLEL_FOREACH runs its loops on, for
+    //   the loops that start afterwards. 1 runs them serially; 0 restores the
+    //   default.
+    inline void set_parallel_concurrency(unsigned concurrency)
+    {
+        foreach_detail_::parallel_concurrency_().store(concurrency);
+    }
+} // namespace foreach
+
+namespace foreach_detail_
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// in_parallel_pool_
+//   True on a thread that is running the body of a parallel loop. A loop
+//   nested in the body of another runs serially on the thread that meets it.
+inline bool &in_parallel_pool_()
+{
+    static thread_local bool in_pool = false;
+    return in_pool;
+}
+
+struct parallel_pool_scope
+{
+    parallel_pool_scope() : was(in_parallel_pool_()) { in_parallel_pool_() = true; }
+    ~parallel_pool_scope() { in_parallel_pool_() = this->was; }
+    bool const was;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// parallel_job
+//   The work of one loop, shared out between the participating threads.
+//   Participant 0 is the thread that runs the loop.
+struct parallel_job
+{
+    virtual void run(unsigned participant) = 0;
+
+protected:
+    ~parallel_job() {}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// parallel_pool
+//   The worker threads, started on demand and kept for the life of the
+//   program. The pool runs one loop at a time; a loop that finds it busy runs
+//   serially on its own thread rather than waiting.
+class parallel_pool
+{
+public:
+    static parallel_pool &instance()
+    {
+        static parallel_pool pool;
+        return pool;
+    }
+
+    // Runs job.run(0) ... job.run(participants - 1), the first on the calling
+    // thread. Returns false, having run nothing, if the pool is busy.
+    bool try_run(parallel_job &job, unsigned participants)
+    {
+        std::unique_lock<std::mutex> busy(this->busy_, std::try_to_lock);
+        if(!busy.owns_lock())
+            return false;
+
+        participants = this->start_workers(participants);
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            this->job_ = &job;
+            this->participants_ = participants;
+            this->pending_ = participants - 1;
+            ++this->generation_;
+        }
+        this->wake_.notify_all();
+
+        {
+            parallel_pool_scope scope;
+            job.run(0);
+        }
+
+        std::unique_lock<std::mutex> lock(this->mutex_);
+        this->done_.wait(lock, [this] { return 0 == this->pending_; });
+        this->job_ = 0;
+        return true;
+    }
+
+private:
+    parallel_pool()
+      : job_(0)
+      , participants_(0)
+      , pending_(0)
+      , generation_(0)
+      , stop_(false)
+    {
+    }
+
+    ~parallel_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            this->stop_ = true;
+        }
+        this->wake_.notify_all();
+        for(std::thread &worker : this->workers_)
+            worker.join();
+    }
+
+    parallel_pool(parallel_pool const &);
+    parallel_pool &operator =(parallel_pool const &);
+
+    // Makes sure there are workers for participants 1 ... participants - 1,
+    // and returns how many participants there are threads for.
+    unsigned start_workers(unsigned participants)
+    {
+        try
+        {
+            while(this->workers_.size() + 1 < participants)
+            {
+                // the new worker waits for the next loop, not the last one
+                unsigned const id = static_cast<unsigned>(this->workers_.size() + 1);
+                unsigned long long const seen = this->generation_;
+                this->workers_.push_back(std::thread([this, id, seen] { this->work(id, seen); }));
+            }
+        }
+        catch(std::system_error const &)
+        {
+            // make do with the threads we have
+        }
+        return (std::min)(participants, static_cast<unsigned>(this->workers_.size() + 1));
+    }
+
+    void work(unsigned id, unsigned long long seen)
+    {
+        in_parallel_pool_() = true;
+        for(;;)
+        {
+            parallel_job *job = 0;
+            {
+                std::unique_lock<std::mutex> lock(this->mutex_);
+                this->wake_.wait(lock, [&] { return this->stop_ || seen != this->generation_; });
+                if(this->stop_)
+                    return;
+                seen = this->generation_;
+                if(id >= this->participants_)
+                    continue;
+                job = this->job_;
+            }
+
+            job->run(id);
+
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            if(0 == --this->pending_)
+                this->done_.notify_one();
+        }
+    }
+
+    std::mutex busy_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::vector<std::thread> workers_;
+    parallel_job *job_;
+    unsigned participants_;
+    unsigned pending_;
+    unsigned long long generation_;
+    bool stop_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// parallel_for_job
+//   Splits [0, size) evenly between the participants. Each takes small chunks
+//   from the front of its own share; a participant whose share is used up
+//   steals the back half of what is left of another's, and carries on with
+//   that. The first exception thrown by the body stops the other participants
+//   taking more work, and is kept to be rethrown on the calling thread.
+template<typename Iter, typename F>
+struct parallel_for_job
+  : parallel_job
+{
+    parallel_for_job(Iter begin, std::size_t size, unsigned participants, F &f)
+      : begin(begin)
+      , grain((std::max)(std::size_t(1), size / (std::size_t(participants) * 16u)))
+      , shares(participants)
+      , failed(false)
+      , f(f)
+    {
+        for(unsigned i = 0; i != participants; ++i)
+        {
+            this->shares[i].first = size * i / participants;
+            this->shares[i].last = size * (i + 1) / participants;
+        }
+    }
+
+    virtual void run(unsigned me)
+    {
+        try
+        {
+            std::size_t first = 0, last = 0;
+            while(this->take(me, first, last) || this->steal(me))
+            {
+                for(; first != last; ++first)
+                    this->f(*(this->begin + static_cast<difference_type>(first)));
+                if(this->failed.load(std::memory_order_relaxed))
+                    break;
+            }
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(this->error_mutex);
+            if(!this->error)
+                this->error = std::current_exception();
+            this->failed.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    void rethrow() const
+    {
+        if(this->error)
+            std::rethrow_exception(this->error);
+    }
+
+private:
+    typedef BOOST_DEDUCED_TYPENAME iterator_difference<Iter>::type difference_type;
+
+    // each share on its own cache line, so that participants taking work
+    // from their own do not slow each other down. They are allocated with
+    // aligned_allocator, which keeps that alignment before C++17's aligned new.
+    // (Not std::hardware_destructive_interference_size, whose value GCC warns
+    // may change between compiler versions and flags.)
+    struct alignas(64) share
+    {
+        std::mutex mutex;
+        std::size_t first, last;
+    };
+
+    // takes a chunk from the front of this participant's own share
+    bool take(unsigned me, std::size_t &first, std::size_t &last)
+    {
+        if(this->failed.load(std::memory_order_relaxed))
+            return false;
+        share &mine = this->shares[me];
+        std::lock_guard<std::mutex> lock(mine.mutex);
+        first = mine.first;
+        last = (std::min)(mine.last, first + this->grain);
+        mine.first = last;
+        return first != last;
+    }
+
+    // moves the back half of another participant's share into this one's
+    bool steal(unsigned me)
+    {
+        unsigned const participants = static_cast<unsigned>(this->shares.size());
+        for(unsigned i = 1; i != participants && !this->failed.load(std::memory_order_relaxed); ++i)
+        {
+            share &victim = this->shares[(me + i) % participants];
+            std::size_t first = 0, last = 0;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                std::size_t const left = victim.last - victim.first;
+                if(0 == left)
+                    continue;
+                first = victim.last - (left + 1) / 2;
+                last = victim.last;
+                victim.last = first;
+            }
+            share &mine = this->shares[me];
+            std::lock_guard<std::mutex> lock(mine.mutex);
+            mine.first = first;
+            mine.last = last;
+            return true;
+        }
+        return false;
+    }
+
+    Iter const begin;
+    std::size_t const grain;
+    std::vector<share, boost::alignment::aligned_allocator<share> > shares;
+    std::atomic<bool> failed;
+    std::mutex error_mutex;
+    std::exception_ptr error;
+    F &f;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// parallel_loop
+//   The left operand of the ->* that hands the body of the loop, as a lambda,
+//   to the pool.
+template<typename Iter>
+struct parallel_loop
+{
+    parallel_loop(Iter begin, Iter end)
+      : begin(begin)
+      , size(static_cast<std::size_t>(end - begin))
+    {
+    }
+
+    template<typename F>
+    void operator ->*(F f) const
+    {
+        unsigned const participants = static_cast<unsigned>(
+            (std::min)(std::size_t(boost::foreach::parallel_concurrency()), this->size));
+        if(1 < participants && !in_parallel_pool_())
+        {
+            parallel_for_job<Iter, F> job(this->begin, this->size, participants, f);
+            if(parallel_pool::instance().try_run(job, participants))
+            {
+                job.rethrow();
+                return;
+            }
+        }
+        for(std::size_t i = 0; i != this->size; ++i)
+            f(*(this->begin + static_cast<BOOST_DEDUCED_TYPENAME iterator_difference<Iter>::type>(i)));
+    }
+
+private:
+    Iter const begin;
+    std::size_t const size;
+};
+
+template<typename T, typename C>
+inline parallel_loop<BOOST_DEDUCED_TYPENAME foreach_iterator<T, C>::type>
+make_parallel_loop(auto_any_t cur, auto_any_t end, type2type<T, C> *)
+{
+    typedef BOOST_DEDUCED_TYPENAME bounded_iterator_<T, C>::type iter_t;
+    BOOST_MPL_ASSERT_MSG( (is_random_access_<iter_t>::value), BOOST_PARALLEL_FOREACH_NEEDS_RANDOM_ACCESS_ITERATORS, (T&) );
+    return parallel_loop<iter_t>(
+        auto_any_cast<iter_t, boost::mpl::false_>(cur)
+      , auto_any_cast<iter_t, boost::mpl::false_>(end));
+}
+
+} // namespace foreach_detail_
+
+} // namespace boost
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_PARALLEL_FOREACH
+//
+//   BOOST_PARALLEL_FOREACH(VAR, COL) { body };
+//
+//   VAR must be a declaration, and COL a collection with random-access
+//   iterators. COL is evaluated once, as BOOST_FOREACH evaluates it: rvalues
+//   and lightweight proxies are copied, and live until the loop has finished.
+//   The body runs once for each element, on any of the pool's threads, and
+//   may not rely on the order of the elements. An exception thrown by the body
+//   stops the loop and is rethrown to the caller once every thread is done.
+//
+#define BOOST_PARALLEL_FOREACH(VAR, COL)                                                        \
+    BOOST_FOREACH_PREAMBLE()                                                                    \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_col) = BOOST_FOREACH_CONTAIN(COL)) {} else   \
+    BOOST_FOREACH_AUDIT_COPY(COL)                                                                                 \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_cur) = BOOST_FOREACH_BEGIN(COL)) {} else     \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_end) = BOOST_FOREACH_END(COL)) {} else       \
+    boost::foreach_detail_::make_parallel_loop(                                                 \
+        BOOST_FOREACH_ID(_foreach_cur)                                                          \
+      , BOOST_FOREACH_ID(_foreach_end)                                                          \
+      , BOOST_FOREACH_TYPEOF(COL)) ->* [&](VAR) -> void
+
+#endif
@@ -0,0 +1,219 @@
+///////////////////////////////////////////////////////////////////////////////
+// foreach_perf.hpp header file
+//
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+// See http://www.boost.org/libs/foreach for documentation
+
+// With BOOST_FOREACH_PERF_COUNTERS defined, the loop profile of
+// <boost/foreach_profile.hpp> also counts, per call site, the events a group
+// of Linux perf_event_open counters saw while the loops ran: instructions,
+// cycles, cache misses and branch misses where the hardware counters can be
+// read, and task-clock, page faults and context switches where they cannot,
+// as in most virtual machines.
+//
+//   #define BOOST_FOREACH_PERF_COUNTERS
+//   #include <boost/foreach.hpp>
+//   #include <boost/foreach_profile.hpp>
+//   ...
+//   boost::foreach::profile::dump(std::cerr);
+//
+// Each thread opens its own group, the first time it runs a loop, and reads
+// it as the loop starts and as it ends: two system calls per loop.
+
+#ifndef BOOST_FOREACH_PERF_HPP
+#define BOOST_FOREACH_PERF_HPP
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/config.hpp>
+
+#if !defined(__linux__)
+# error BOOST_FOREACH_PERF_COUNTERS requires Linux perf_event_open
+#endif
+
+#if defined(BOOST_NO_CXX11_THREAD_LOCAL)
+# error BOOST_FOREACH_PERF_COUNTERS requires C++11 thread_local
+#endif
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstring>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+namespace boost
+{
+
+namespace foreach_detail_
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// perf_event_set
+//   The events a group counts, the first of them the group's leader.
+std::size_t const perf_max_events = 4;
+
+struct perf_event_set
+{
+    std::size_t size;
+    bool hardware;
+    char const *names[perf_max_events];
+    unsigned types[perf_max_events];
+    unsigned long long configs[perf_max_events];
+};
+
+inline perf_event_set const &perf_hardware_events()
+{
+    static perf_event_set const events = {
+        4, true
+      , {"instructions", "cycles", "cache-misses", "branch-misses"}
+      , {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE}
+      , {PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES}
+    };
+    return events;
+}
+
+inline perf_event_set const &perf_software_events()
+{
+    static perf_event_set const events = {
+        3, false
+      , {"task-clock", "page-faults", "context-switches", 0}
+      , {PERF_TYPE_SOFTWARE, PERF_TYPE_SOFTWARE, PERF_TYPE_SOFTWARE, 0}
+      , {PERF_COUNT_SW_TASK_CLOCK, PERF_COUNT_SW_PAGE_FAULTS, PERF_COUNT_SW_CONTEXT_SWITCHES, 0}
+    };
+    return events;
+}
+
+inline perf_event_set const &perf_no_events()
+{
+    static perf_event_set const events = {0, false, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}};
+    return events;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// perf_group
+//   A group of counters of the calling thread, in user space only, so that
+//   it opens at the default perf_event_paranoid level. The kernel schedules a
+//   group onto the counters as a unit, so that its events are counted over
+//   the same stretches of time. If any of its events cannot be opened, the
+//   group counts nothing.
+struct perf_group
+{
+    explicit perf_group(perf_event_set const &events)
+      : size(0)
+    {
+        for(std::size_t i = 0; i != events.size; ++i)
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = events.types[i];
+            attr.config = events.configs[i];
+            attr.read_format = PERF_FORMAT_GROUP;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            int const fd = static_cast<int>(::syscall(__NR_perf_event_open, &attr, 0, -1, i ? fds[0] : -1, 0ul));
+            if(-1 == fd)
+            {
+                close();
+                return;
+            }
+            fds[size++] = fd;
+        }
+    }
+
+    ~perf_group()
+    {
+        close();
+    }
+
+    void close()
+    {
+        // Closing the leader last keeps the group whole until it goes.
+        while(0 != size)
+            ::close(fds[--size]);
+    }
+
+    // Reads the counts of the group's events into counts; false if the group
+    // counts nothing.
+    bool read(unsigned long long *counts) const
+    {
+        unsigned long long values[1 + perf_max_events];
+        std::size_t const bytes = (1 + size) * sizeof(values[0]);
+        if(0 == size || static_cast<ssize_t>(bytes) != ::read(fds[0], values, bytes))
+            return false;
+        for(std::size_t i = 0; i != size; ++i)
+            counts[i] = values[1 + i];
+        return true;
+    }
+
+    std::size_t size;
+    int fds[perf_max_events];
+
+private:
+    perf_group(perf_group const &);
+    perf_group &operator=(perf_group const &);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// perf_events
+//   The events the program counts: the hardware events if a group of them
+//   opens, else the software events, else none. All the threads count the
+//   same ones.
+inline perf_event_set const &perf_events()
+{
+    static perf_event_set const &events =
+        perf_group(perf_hardware_events()).size ? perf_hardware_events()
+      : perf_group(perf_software_events()).size ? perf_software_events()
+      : perf_no_events();
+    return events;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// perf_read
+//   Reads the counters of the calling thread, opening them the first time;
+//   false if it has none.
+inline bool perf_read(unsigned long long *counts)
+{
+    static thread_local perf_group const group(foreach_detail_::perf_events());
+    return group.read(counts);
+}
+
+} // namespace foreach_detail_
+
+namespace foreach
+{
+namespace perf
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // events
+    //   The names of the events that profile::site_profile::events counts, in
+    //   its order, as perf-stat(1) names them; empty if perf_event_open can
+    //   count none of them, because the kernel lacks it or forbids it.
+    inline std::vector<std::string> events()
+    {
+        foreach_detail_::perf_event_set const &set = foreach_detail_::perf_events();
+        return std::vector<std::string>(set.names, set.names + set.size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // hardware
+    //   Whether the events counted are the hardware events, rather than the
+    //   software events that stand in for them.
+    inline bool hardware()
+    {
+        return foreach_detail_::perf_events().hardware;
+    }
+} // namespace perf
+} // namespace foreach
+
+} // namespace boost
+
+#endif
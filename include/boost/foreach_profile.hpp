@@ -0,0 +1,497 @@
+///////////////////////////////////////////////////////////////////////////////
+// foreach_profile.hpp header file
+//
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+// See http://www.boost.org/libs/foreach for documentation
+
+// With BOOST_FOREACH_PROFILE defined, every BOOST_FOREACH and
+// BOOST_REVERSE_FOREACH counts, per call site, the loops it runs, the number
+// of iterations of each and the time they take, in counters of the thread
+// that runs them. boost::foreach::profile::dump() merges the counters of all
+// the threads and writes them out, the sites that took the most time first.
+//
+//   #define BOOST_FOREACH_PROFILE
+//   #include <boost/foreach.hpp>
+//   #include <boost/foreach_profile.hpp>
+//   ...
+//   boost::foreach::profile::dump(std::cerr);
+//
+// Without BOOST_FOREACH_PROFILE the loops expand exactly as before, and the
+// functions here report nothing. BOOST_FOREACH_PERF_COUNTERS and
+// BOOST_FOREACH_TRACE imply BOOST_FOREACH_PROFILE. The first has the profile
+// count hardware events as well; see <boost/foreach_perf.hpp>. The second
+// records each loop as a span on a timeline; see <boost/foreach_trace.hpp>.
+
+#ifndef BOOST_FOREACH_PROFILE_HPP
+#define BOOST_FOREACH_PROFILE_HPP
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/config.hpp>
+
+#if defined(BOOST_NO_CXX11_LAMBDAS) || defined(BOOST_NO_CXX11_HDR_MUTEX)                       \
+ || defined(BOOST_NO_CXX11_HDR_ATOMIC) || defined(BOOST_NO_CXX11_HDR_CHRONO)                    \
+ || defined(BOOST_NO_CXX11_THREAD_LOCAL) || defined(BOOST_NO_CXX11_RVALUE_REFERENCES)           \
+ || defined(BOOST_NO_CXX11_SMART_PTR)
+# error BOOST_FOREACH_PROFILE requires C++11 lambdas, atomics, thread_local and <chrono>
+#endif
+
+#include <boost/foreach.hpp>
+
+#if !defined(BOOST_FOREACH_CONTAIN)
+# error <boost/foreach_profile.hpp> needs <boost/foreach.hpp> without BOOST_FOREACH_LITE
+#endif
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <ostream>
+#include <iostream>
+#include <algorithm>
+#include <boost/core/typeinfo.hpp>
+
+#ifdef BOOST_FOREACH_PERF_COUNTERS
+# include <boost/foreach_perf.hpp>
+#endif
+
+namespace boost
+{
+
+namespace foreach_detail_
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// profile_counters
+//   What one thread has counted at one call site. Only the thread that owns
+//   the counters writes them, with plain loads and stores; they are atomic so
+//   that dump() can read them while it runs. Bucket 0 of the histogram counts
+//   the loops with no iterations, and bucket b > 0 those with 2^(b-1) to
+//   2^b - 1. events counts the perf events, in the order of perf_events().
+struct profile_counters
+{
+    static std::size_t const buckets = 65;
+
+    profile_counters()
+      : entries(0)
+      , iterations(0)
+      , nanoseconds(0)
+    {
+        for(std::size_t b = 0; b != buckets; ++b)
+            histogram[b].store(0, std::memory_order_relaxed);
+#ifdef BOOST_FOREACH_PERF_COUNTERS
+        for(std::size_t e = 0; e != perf_max_events; ++e)
+            events[e].store(0, std::memory_order_relaxed);
+#endif
+    }
+
+    static void add(std::atomic<unsigned long long> &counter, unsigned long long n)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    void add(profile_counters const &that)
+    {
+        add(entries, that.entries.load(std::memory_order_relaxed));
+        add(iterations, that.iterations.load(std::memory_order_relaxed));
+        add(nanoseconds, that.nanoseconds.load(std::memory_order_relaxed));
+        for(std::size_t b = 0; b != buckets; ++b)
+            add(histogram[b], that.histogram[b].load(std::memory_order_relaxed));
+#ifdef BOOST_FOREACH_PERF_COUNTERS
+        for(std::size_t e = 0; e != perf_max_events; ++e)
+            add(events[e], that.events[e].load(std::memory_order_relaxed));
+#endif
+    }
+
+    static std::size_t bucket(unsigned long long trips)
+    {
+        std::size_t b = 0;
+        for(; 0 != trips; trips >>= 1)
+            ++b;
+        return b;
+    }
+
+    std::atomic<unsigned long long> entries;
+    std::atomic<unsigned long long> iterations;
+    std::atomic<unsigned long long> nanoseconds;
+    std::atomic<unsigned long long> histogram[buckets];
+#ifdef BOOST_FOREACH_PERF_COUNTERS
+    std::atomic<unsigned long long> events[perf_max_events];
+#endif
+};
+
+inline void profile_merge(std::vector<std::unique_ptr<profile_counters> > &totals,
+                          std::vector<std::unique_ptr<profile_counters> > const &counters)
+{
+    if(totals.size() < counters.size())
+        totals.resize(counters.size());
+    for(std::size_t i = 0; i != counters.size(); ++i)
+    {
+        if(!counters[i])
+            continue;
+        if(!totals[i])
+            totals[i].reset(new profile_counters);
+        totals[i]->add(*counters[i]);
+    }
+}
+
+struct profile_thread;
+
+#ifdef BOOST_FOREACH_TRACE
+// Records the loop as a span, if the sampling allows. Defined in
+// <boost/foreach_trace.hpp>, which this file includes at its end.
+inline void trace_span(std::size_t site, std::chrono::steady_clock::time_point start,
+                       std::chrono::steady_clock::time_point end, unsigned long long trips);
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// profile_registry
+//   The call sites, in the order they first ran, the threads that have run
+//   one, and the counters of the threads that have since exited.
+struct profile_site
+{
+    char const *file;
+    int line;
+    std::string type;
+};
+
+struct profile_registry
+{
+    std::mutex mutex;
+    std::vector<profile_site> sites;
+    std::vector<profile_thread *> threads;
+    std::vector<std::unique_ptr<profile_counters> > retired;
+
+    static profile_registry &instance()
+    {
+        static profile_registry registry;
+        return registry;
+    }
+
+    // The index of a call site. Copies of a site, in the translation units
+    // that instantiate the same inline function, share one.
+    std::size_t site(char const *file, int line, std::string const &type)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for(std::size_t i = 0; i != sites.size(); ++i)
+        {
+            profile_site const &s = sites[i];
+            if(s.line == line && s.type == type && std::string(s.file) == file)
+                return i;
+        }
+        profile_site s = {file, line, type};
+        sites.push_back(s);
+        return sites.size() - 1;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// profile_thread
+//   The counters of one thread, by call site. The thread grows the vector
+//   under its mutex, so that dump() can walk it under the same mutex; when the
+//   thread exits, its counters are added to the registry's.
+struct profile_thread
+{
+    std::mutex mutex;
+    std::vector<std::unique_ptr<profile_counters> > sites;
+
+    profile_thread()
+    {
+        profile_registry &registry = profile_registry::instance();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.threads.push_back(this);
+    }
+
+    ~profile_thread()
+    {
+        profile_registry &registry = profile_registry::instance();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        merge_into(registry.retired);
+        registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), this));
+    }
+
+    static profile_thread &instance()
+    {
+        static thread_local profile_thread thread;
+        return thread;
+    }
+
+    profile_counters &counters(std::size_t site)
+    {
+        if(site >= sites.size() || !sites[site])
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(site >= sites.size())
+                sites.resize(site + 1);
+            sites[site].reset(new profile_counters);
+        }
+        return *sites[site];
+    }
+
+    // Called with the registry's mutex held.
+    void merge_into(std::vector<std::unique_ptr<profile_counters> > &totals)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        profile_merge(totals, sites);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// profile_scope
+//   Lives as long as the loop it profiles, and records the loop in its
+//   destructor, however the loop ends: when the collection runs out, by break,
+//   return or goto, or by an exception. Moving it hands the recording over.
+//   The perf counters are read inside the clock readings, as close to the
+//   loop as they can be.
+struct profile_scope
+{
+    profile_scope(std::size_t site)
+      : site(site)
+      , trips(0)
+      , armed(true)
+      , start(std::chrono::steady_clock::now())
+    {
+#ifdef BOOST_FOREACH_PERF_COUNTERS
+        counting = perf_read(counts);
+#endif
+    }
+
+    profile_scope(profile_scope &&that)
+      : site(that.site)
+      , trips(that.trips)
+      , armed(that.armed)
+      , start(that.start)
+    {
+#ifdef BOOST_FOREACH_PERF_COUNTERS
+        counting = that.counting;
+        std::copy(that.counts, that.counts + perf_max_events, counts);
+#endif
+        that.armed = false;
+    }
+
+    ~profile_scope()
+    {
+        if(!armed)
+            return;
+#ifdef BOOST_FOREACH_PERF_COUNTERS
+        unsigned long long finish[perf_max_events];
+        bool const counted = counting && perf_read(finish);
+#endif
+        std::chrono::steady_clock::time_point const end = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::duration const elapsed = end - start;
+        profile_counters &c = profile_thread::instance().counters(site);
+#ifdef BOOST_FOREACH_PERF_COUNTERS
+        for(std::size_t e = 0; counted && e != perf_max_events; ++e)
+            profile_counters::add(c.events[e], finish[e] - counts[e]);
+#endif
+        profile_counters::add(c.entries, 1);
+        profile_counters::add(c.iterations, trips);
+        profile_counters::add(c.nanoseconds, static_cast<unsigned long long>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        profile_counters::add(c.histogram[profile_counters::bucket(trips)], 1);
+#ifdef BOOST_FOREACH_TRACE
+        foreach_detail_::trace_span(site, start, end, trips);
+#endif
+    }
+
+    std::size_t site;
+    unsigned long long trips;
+    bool armed;
+    std::chrono::steady_clock::time_point start;
+#ifdef BOOST_FOREACH_PERF_COUNTERS
+    bool counting;
+    unsigned long long counts[perf_max_events];
+#endif
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// profile_enter
+//   Starts profiling a loop. Site is the type of a lambda written at the call
+//   site, so that each call site, and each instantiation of a template that
+//   contains one, registers itself once.
+template<typename T, typename C>
+inline std::string profile_type_name(type2type<T, C> *)
+{
+    std::string name = boost::core::demangled_name(BOOST_CORE_TYPEID(T));
+    return C::value ? name + " const" : name;
+}
+
+template<typename T, typename C, typename Site>
+inline auto_any<profile_scope> profile_enter(type2type<T, C> *col, char const *file, int line, Site)
+{
+    static std::size_t const site =
+        profile_registry::instance().site(file, line, foreach_detail_::profile_type_name(col));
+    return auto_any<profile_scope>(profile_scope(site));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// profile_tick
+//   Counts an iteration.
+inline bool profile_tick(auto_any_t scope) BOOST_FOREACH_NOEXCEPT
+{
+    ++auto_any_cast<profile_scope, boost::mpl::false_>(scope).trips;
+    return false;
+}
+
+struct profile_slower
+{
+    template<typename Profile>
+    bool operator()(Profile const &left, Profile const &right) const
+    {
+        return left.nanoseconds > right.nanoseconds;
+    }
+};
+
+} // namespace foreach_detail_
+
+namespace foreach
+{
+namespace profile
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // site_profile
+    //   What the loops at one call site, on all threads, have counted:
+    //   histogram[0] counts the loops that ran no iterations, and histogram[b]
+    //   those that ran from 2^(b-1) to 2^b - 1. events counts the events named
+    //   by perf::events(), and is empty without BOOST_FOREACH_PERF_COUNTERS.
+    //   The time and the events of a loop include those of the loops nested
+    //   in it.
+    struct site_profile
+    {
+        std::string file;
+        int line;
+        std::string type;
+        unsigned long long entries;
+        unsigned long long iterations;
+        unsigned long long nanoseconds;
+        std::vector<unsigned long long> histogram;
+        std::vector<unsigned long long> events;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // collect
+    //   A snapshot of the profiles of the call sites that have run a loop,
+    //   the ones that took the most time first. Loops still running are not
+    //   counted.
+    inline std::vector<site_profile> collect()
+    {
+        using foreach_detail_::profile_counters;
+        foreach_detail_::profile_registry &registry = foreach_detail_::profile_registry::instance();
+        std::vector<site_profile> result;
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        std::vector<std::unique_ptr<profile_counters> > totals;
+        foreach_detail_::profile_merge(totals, registry.retired);
+        for(std::size_t t = 0; t != registry.threads.size(); ++t)
+            registry.threads[t]->merge_into(totals);
+
+        for(std::size_t i = 0; i != totals.size(); ++i)
+        {
+            if(!totals[i])
+                continue;
+            foreach_detail_::profile_site const &s = registry.sites[i];
+            profile_counters const &c = *totals[i];
+            site_profile p;
+            p.file = s.file;
+            p.line = s.line;
+            p.type = s.type;
+            p.entries = c.entries.load(std::memory_order_relaxed);
+            p.iterations = c.iterations.load(std::memory_order_relaxed);
+            p.nanoseconds = c.nanoseconds.load(std::memory_order_relaxed);
+            for(std::size_t b = 0; b != profile_counters::buckets; ++b)
+                p.histogram.push_back(c.histogram[b].load(std::memory_order_relaxed));
+            while(!p.histogram.empty() && 0 == p.histogram.back())
+                p.histogram.pop_back();
+#ifdef BOOST_FOREACH_PERF_COUNTERS
+            for(std::size_t e = 0; e != foreach_detail_::perf_events().size; ++e)
+                p.events.push_back(c.events[e].load(std::memory_order_relaxed));
+#endif
+            result.push_back(p);
+        }
+
+        std::stable_sort(result.begin(), result.end(), foreach_detail_::profile_slower());
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // dump
+    //   Writes the profiles of the call sites, the ones that took the most time
+    //   first, with the histogram of their trip counts: "4-7:12" says that 12
+    //   loops ran from 4 to 7 iterations. With BOOST_FOREACH_PERF_COUNTERS, a
+    //   third line gives the events counted.
+    //
+    //   1.234 ms  1000 loops  50000 iterations  50.0 per loop  main.cpp:42  std::vector<int>
+    //       trips 32-63:1000
+    //       instructions 412345  cycles 301234  cache-misses 812  branch-misses 1009
+    inline void dump(std::ostream &sout)
+    {
+        std::vector<site_profile> const profiles = profile::collect();
+#ifdef BOOST_FOREACH_PERF_COUNTERS
+        std::vector<std::string> const events = perf::events();
+#else
+        std::vector<std::string> const events;
+#endif
+        std::ios_base::fmtflags const flags = sout.flags();
+        std::streamsize const precision = sout.precision();
+        sout.setf(std::ios_base::fixed, std::ios_base::floatfield);
+
+        sout << "BOOST_FOREACH profile: " << profiles.size() << " call sites\n";
+        for(std::size_t i = 0; i != profiles.size(); ++i)
+        {
+            site_profile const &p = profiles[i];
+            sout.precision(3);
+            sout << p.nanoseconds / 1e6 << " ms  "
+                 << p.entries << " loops  "
+                 << p.iterations << " iterations  ";
+            sout.precision(1);
+            sout << (p.entries ? double(p.iterations) / double(p.entries) : 0.0) << " per loop  "
+                 << p.file << ':' << p.line << "  " << p.type << "\n"
+                 << "    trips";
+            for(std::size_t b = 0; b != p.histogram.size(); ++b)
+            {
+                if(0 == p.histogram[b])
+                    continue;
+                unsigned long long const low = b ? 1ull << (b - 1) : 0;
+                unsigned long long const high = b ? low + (low - 1) : 0;
+                sout << ' ' << low;
+                if(high != low)
+                    sout << '-' << high;
+                sout << ':' << p.histogram[b];
+            }
+            sout << '\n';
+            if(!p.events.empty())
+            {
+                sout << "   ";
+                for(std::size_t e = 0; e != p.events.size() && e != events.size(); ++e)
+                    sout << (e ? "  " : " ") << events[e] << ' ' << p.events[e];
+                sout << '\n';
+            }
+        }
+
+        sout.precision(precision);
+        sout.flags(flags);
+    }
+
+    inline void dump()
+    {
+        profile::dump(std::clog);
+    }
+} // namespace profile
+} // namespace foreach
+
+} // namespace boost
+
+#ifdef BOOST_FOREACH_TRACE
+# include <boost/foreach_trace.hpp>
+#endif
+
+#endif
@@ -0,0 +1,438 @@
+///////////////////////////////////////////////////////////////////////////////
+// foreach_set_bit.hpp header file
+//
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+// See http://www.boost.org/libs/foreach for documentation
+
+// BOOST_FOREACH_SET_BIT visits the positions of the set bits of a std::bitset,
+// a boost::dynamic_bitset or a std::vector<bool>, in increasing order. Words
+// with no bits set are skipped whole, and each set bit of a word is found with
+// a count of its trailing zeros, so the loop costs a step per set bit rather
+// than per bit.
+//
+//   BOOST_FOREACH_SET_BIT(std::size_t i, bits)
+//   {
+//       rows[i].update();
+//   }
+
+#ifndef BOOST_FOREACH_SET_BIT_HPP
+#define BOOST_FOREACH_SET_BIT_HPP
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/config.hpp>
+#include <boost/foreach.hpp>
+
+#if !defined(BOOST_FOREACH_CONTAIN)
+# error <boost/foreach_set_bit.hpp> needs <boost/foreach.hpp> without BOOST_FOREACH_LITE
+#endif
+
+#include <bitset>
+#include <vector>
+#include <climits>
+#include <cstddef>
+#include <boost/mpl/assert.hpp>
+#include <boost/dynamic_bitset_fwd.hpp>
+#if defined(BOOST_MSVC)
+# include <intrin.h>
+#endif
+
+namespace boost
+{
+
+namespace foreach_detail_
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// count_trailing_zeros
+//   The position of the lowest set bit of a word that is not 0.
+#if defined(__GNUC__) || defined(__clang__)
+inline unsigned count_trailing_zeros(unsigned int w)
+{
+    return static_cast<unsigned>(__builtin_ctz(w));
+}
+
+inline unsigned count_trailing_zeros(unsigned long w)
+{
+    return static_cast<unsigned>(__builtin_ctzl(w));
+}
+
+inline unsigned count_trailing_zeros(boost::ulong_long_type w)
+{
+    return static_cast<unsigned>(__builtin_ctzll(w));
+}
+#elif defined(BOOST_MSVC)
+inline unsigned count_trailing_zeros(unsigned long w)
+{
+    unsigned long i;
+    _BitScanForward(&i, w);
+    return i;
+}
+
+inline unsigned count_trailing_zeros(unsigned int w)
+{
+    return count_trailing_zeros(static_cast<unsigned long>(w));
+}
+
+inline unsigned count_trailing_zeros(boost::ulong_long_type w)
+{
+# if defined(_M_X64) || defined(_M_ARM64)
+    unsigned long i;
+    _BitScanForward64(&i, w);
+    return i;
+# else
+    unsigned long const low = static_cast<unsigned long>(w);
+    return 0 != low ? count_trailing_zeros(low) : 32 + count_trailing_zeros(static_cast<unsigned long>(w >> 32));
+# endif
+}
+#else
+template<typename Word>
+inline unsigned count_trailing_zeros(Word w)
+{
+    unsigned i = 0;
+    for(; 0 == (w & 1u); w >>= 1)
+        ++i;
+    return i;
+}
+#endif
+
+// Narrower words promote to unsigned int, which keeps their bits.
+inline unsigned count_trailing_zeros(unsigned char w)
+{
+    return count_trailing_zeros(static_cast<unsigned int>(w));
+}
+
+inline unsigned count_trailing_zeros(unsigned short w)
+{
+    return count_trailing_zeros(static_cast<unsigned int>(w));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// set_bit_words
+//   Walks the set bits of size bits stored in an array of words, the first
+//   bit in the lowest bit of the first word. The bits of the last word past
+//   size are masked off.
+template<typename Word>
+struct set_bit_words
+{
+    BOOST_STATIC_CONSTANT(std::size_t, word_bits = sizeof(Word) * CHAR_BIT);
+
+    set_bit_words(Word const *words, std::size_t size)
+      : words(words)
+      , count((size + word_bits - 1) / word_bits)
+      , tail(0 != size % word_bits ? static_cast<Word>((Word(1) << size % word_bits) - 1) : static_cast<Word>(~Word(0)))
+      , i(0)
+      , word(0 != this->count ? this->load(0) : Word(0))
+    {
+        this->settle();
+    }
+
+    BOOST_FOREACH_DEBUG_INLINE bool done() const
+    {
+        return 0 == this->word;
+    }
+
+    BOOST_FOREACH_DEBUG_INLINE std::size_t index() const
+    {
+        return this->i * word_bits + count_trailing_zeros(this->word);
+    }
+
+    BOOST_FOREACH_DEBUG_INLINE void next()
+    {
+        this->word = static_cast<Word>(this->word & (this->word - 1));
+        this->settle();
+    }
+
+protected:
+    // points the cursor at a copy of the words it was walking
+    void rebase(Word const *copy)
+    {
+        this->words = copy;
+    }
+
+private:
+    Word load(std::size_t k) const
+    {
+        return this->count == k + 1 ? static_cast<Word>(this->words[k] & this->tail) : this->words[k];
+    }
+
+    // moves on to the next word with a bit set, if the current one has none left
+    BOOST_FOREACH_DEBUG_INLINE void settle()
+    {
+        while(0 == this->word && ++this->i < this->count)
+            this->word = this->load(this->i);
+    }
+
+    Word const *words;
+    std::size_t count;
+    Word tail;
+    std::size_t i;
+    Word word;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// set_bit_scan
+//   Walks the set bits of a collection that exposes neither its words nor a
+//   search for the next set bit, testing them one at a time.
+template<typename Bits>
+struct set_bit_scan
+{
+    explicit set_bit_scan(Bits const &bits)
+      : bits(&bits)
+      , pos(0)
+    {
+        this->settle();
+    }
+
+    BOOST_FOREACH_DEBUG_INLINE bool done() const
+    {
+        return this->pos == this->bits->size();
+    }
+
+    BOOST_FOREACH_DEBUG_INLINE std::size_t index() const
+    {
+        return this->pos;
+    }
+
+    BOOST_FOREACH_DEBUG_INLINE void next()
+    {
+        ++this->pos;
+        this->settle();
+    }
+
+private:
+    void settle()
+    {
+        for(std::size_t const size = this->bits->size(); this->pos != size && !(*this->bits)[this->pos]; ++this->pos)
+        {
+        }
+    }
+
+    Bits const *bits;
+    std::size_t pos;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// set_bit_blocks
+//   Walks the set bits of a boost::dynamic_bitset, which hides its blocks, in
+//   a copy of them. (Its own find_next() looks for the lowest set bit of a
+//   block a bit at a time.)
+template<typename Block>
+struct set_bit_block_copy
+{
+    explicit set_bit_block_copy(std::size_t n)
+      : blocks(n)
+    {
+    }
+
+    Block const *data() const
+    {
+        return this->blocks.empty() ? 0 : &this->blocks[0];
+    }
+
+    std::vector<Block> blocks;
+};
+
+template<typename Block>
+struct set_bit_blocks
+  : private set_bit_block_copy<Block>
+  , set_bit_words<Block>
+{
+    template<typename Allocator>
+    explicit set_bit_blocks(boost::dynamic_bitset<Block, Allocator> const &bits)
+      : set_bit_block_copy<Block>(bits.num_blocks())
+      , set_bit_words<Block>(0, 0)
+    {
+        // found by ADL; <boost/dynamic_bitset.hpp> defines it
+        to_block_range(bits, this->blocks.begin());
+        static_cast<set_bit_words<Block> &>(*this) = set_bit_words<Block>(this->data(), bits.size());
+    }
+
+    set_bit_blocks(set_bit_blocks const &that)
+      : set_bit_block_copy<Block>(that)
+      , set_bit_words<Block>(that)
+    {
+        this->rebase(this->data());
+    }
+
+private:
+    set_bit_blocks &operator =(set_bit_blocks const &);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// set_bits_
+//   How BOOST_FOREACH_SET_BIT walks a collection of bits.
+template<typename Bits>
+struct set_bits_
+{
+    // **** READ THIS IF YOUR COMPILE BREAKS HERE ****
+    //
+    // BOOST_FOREACH_SET_BIT iterates over std::bitset, boost::dynamic_bitset
+    // and std::vector<bool>. To find the set bits of another collection, use
+    // BOOST_FOREACH_INDEXED and test each element.
+    BOOST_MPL_ASSERT_MSG( false, BOOST_FOREACH_SET_BIT_NEEDS_A_BITSET_OR_A_VECTOR_OF_BOOL, (Bits&) );
+};
+
+template<typename Block, typename Allocator>
+struct set_bits_<boost::dynamic_bitset<Block, Allocator> >
+{
+    typedef set_bit_blocks<Block> type;
+
+    static type make(boost::dynamic_bitset<Block, Allocator> const &bits)
+    {
+        return type(bits);
+    }
+};
+
+// libstdc++ keeps the bits of a std::bitset in an array of unsigned longs,
+// which is all there is to the object. Its debug mode wraps it.
+template<std::size_t N>
+struct set_bits_<std::bitset<N> >
+{
+#if defined(__GLIBCXX__) && !defined(_GLIBCXX_DEBUG)
+    typedef set_bit_words<unsigned long> type;
+
+    static type make(std::bitset<N> const &bits)
+    {
+        return type(reinterpret_cast<unsigned long const *>(&bits), N);
+    }
+#else
+    typedef set_bit_scan<std::bitset<N> > type;
+
+    static type make(std::bitset<N> const &bits)
+    {
+        return type(bits);
+    }
+#endif
+};
+
+// libstdc++ stores the bits of a std::vector<bool> in words, starting at the
+// lowest bit of the word its begin() points into. Its debug mode hides them.
+template<typename Allocator>
+struct set_bits_<std::vector<bool, Allocator> >
+{
+#if defined(__GLIBCXX__) && !defined(_GLIBCXX_DEBUG)
+    typedef std::_Bit_type word;
+    typedef set_bit_words<word> type;
+
+    static type make(std::vector<bool, Allocator> const &bits)
+    {
+        return type(bits.begin()._M_p, bits.size());
+    }
+#else
+    typedef set_bit_scan<std::vector<bool, Allocator> > type;
+
+    static type make(std::vector<bool, Allocator> const &bits)
+    {
+        return type(bits);
+    }
+#endif
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// set_bit_begin
+//
+template<typename T, typename C>
+inline auto_any<BOOST_DEDUCED_TYPENAME set_bits_<T>::type>
+set_bit_begin(auto_any_t col, type2type<T, C> *, boost::mpl::true_ *) // rvalue
+{
+    return auto_any<BOOST_DEDUCED_TYPENAME set_bits_<T>::type>(
+        set_bits_<T>::make(auto_any_cast<T, C>(col)));
+}
+
+template<typename T, typename C>
+inline auto_any<BOOST_DEDUCED_TYPENAME set_bits_<T>::type>
+set_bit_begin(auto_any_t col, type2type<T, C> *, boost::mpl::false_ *) // lvalue
+{
+    typedef BOOST_DEDUCED_TYPENAME type2type<T, C>::type type;
+    return auto_any<BOOST_DEDUCED_TYPENAME set_bits_<T>::type>(
+        set_bits_<T>::make(BOOST_FOREACH_DEREFOF((auto_any_cast<type *, boost::mpl::false_>(col)))));
+}
+
+#ifdef BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION
+template<typename T>
+inline auto_any<BOOST_DEDUCED_TYPENAME set_bits_<T>::type>
+set_bit_begin(auto_any_t col, type2type<T, const_> *, bool *)
+{
+    return auto_any<BOOST_DEDUCED_TYPENAME set_bits_<T>::type>(
+        set_bits_<T>::make(*auto_any_cast<simple_variant<T>, boost::mpl::false_>(col).get()));
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// set_bit_done/set_bit_next/set_bit_index
+//
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE bool set_bit_done(auto_any_t cur, type2type<T, C> *)
+{
+    typedef BOOST_DEDUCED_TYPENAME set_bits_<T>::type cursor_t;
+    return auto_any_cast<cursor_t, boost::mpl::false_>(cur).done();
+}
+
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE void set_bit_next(auto_any_t cur, type2type<T, C> *)
+{
+    typedef BOOST_DEDUCED_TYPENAME set_bits_<T>::type cursor_t;
+    auto_any_cast<cursor_t, boost::mpl::false_>(cur).next();
+}
+
+template<typename T, typename C>
+BOOST_FOREACH_DEBUG_INLINE std::size_t set_bit_index(auto_any_t cur, type2type<T, C> *)
+{
+    typedef BOOST_DEDUCED_TYPENAME set_bits_<T>::type cursor_t;
+    return auto_any_cast<cursor_t, boost::mpl::false_>(cur).index();
+}
+
+} // namespace foreach_detail_
+
+} // namespace boost
+
+#define BOOST_FOREACH_SET_BIT_BEGIN(BITS)                                                       \
+    boost::foreach_detail_::set_bit_begin(                                                      \
+        BOOST_FOREACH_ID(_foreach_col)                                                          \
+      , BOOST_FOREACH_TYPEOF(BITS)                                                              \
+      , BOOST_FOREACH_SHOULD_COPY(BITS))
+
+#define BOOST_FOREACH_SET_BIT_DONE(BITS)                                                        \
+    boost::foreach_detail_::set_bit_done(                                                       \
+        BOOST_FOREACH_ID(_foreach_cur)                                                          \
+      , BOOST_FOREACH_TYPEOF(BITS))
+
+#define BOOST_FOREACH_SET_BIT_NEXT(BITS)                                                        \
+    boost::foreach_detail_::set_bit_next(                                                       \
+        BOOST_FOREACH_ID(_foreach_cur)                                                          \
+      , BOOST_FOREACH_TYPEOF(BITS))
+
+#define BOOST_FOREACH_SET_BIT_INDEX(BITS)                                                       \
+    boost::foreach_detail_::set_bit_index(                                                      \
+        BOOST_FOREACH_ID(_foreach_cur)                                                          \
+      , BOOST_FOREACH_TYPEOF(BITS))
+
+///////////////////////////////////////////////////////////////////////////////
+// BOOST_FOREACH_SET_BIT
+//
+//   BOOST_FOREACH_SET_BIT(IDX, BITS) { body }
+//
+//   IDX is a std::size_t, declared or assigned, that takes the position of
+//   each set bit of BITS in turn, lowest first. BITS is evaluated once, as
+//   BOOST_FOREACH evaluates its collection, and must not change during the
+//   loop. break and continue work as in BOOST_FOREACH.
+//
+#define BOOST_FOREACH_SET_BIT(IDX, BITS)                                                                          \
+    BOOST_FOREACH_PREAMBLE()                                                                                      \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_col) = BOOST_FOREACH_CONTAIN(BITS)) {} else  \
+    BOOST_FOREACH_AUDIT_COPY(BITS)                                                                                \
+    if (boost::foreach_detail_::auto_any_t BOOST_FOREACH_ID(_foreach_cur) = BOOST_FOREACH_SET_BIT_BEGIN(BITS)) {} else \
+    for (bool BOOST_FOREACH_ID(_foreach_continue) = true;                                                         \
+              BOOST_FOREACH_ID(_foreach_continue) && !BOOST_FOREACH_SET_BIT_DONE(BITS);                           \
+              BOOST_FOREACH_ID(_foreach_continue) ? BOOST_FOREACH_SET_BIT_NEXT(BITS) : (void)0)                   \
+        if  (boost::foreach_detail_::set_false(BOOST_FOREACH_ID(_foreach_continue))) {} else                      \
+        for (IDX = BOOST_FOREACH_SET_BIT_INDEX(BITS); !BOOST_FOREACH_ID(_foreach_continue); BOOST_FOREACH_ID(_foreach_continue) = true)
+
+#endif
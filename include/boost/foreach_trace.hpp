@@ -0,0 +1,372 @@
+///////////////////////////////////////////////////////////////////////////////
+// foreach_trace.hpp header file
+//
+// Copyright 2026 agent.
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+// See http://www.boost.org/libs/foreach for documentation
+
+// With BOOST_FOREACH_TRACE defined, every BOOST_FOREACH and
+// BOOST_REVERSE_FOREACH that the loop profile of <boost/foreach_profile.hpp>
+// times is also recorded as a span, with its call site and trip count, in a
+// ring buffer of the thread that runs it. boost::foreach::trace::flush()
+// writes the spans recorded since it last ran as Chrome Trace Event JSON,
+// which chrome://tracing and Perfetto open.
+//
+//   #define BOOST_FOREACH_TRACE
+//   #include <boost/foreach.hpp>
+//   ...
+//   std::ofstream json("loops.json");
+//   boost::foreach::trace::flush(json);
+//
+// trace::set_threshold() records only the loops that take at least so long,
+// and trace::set_sampling() one in so many of those, to bound the cost and
+// the size of the trace.
+
+#ifndef BOOST_FOREACH_TRACE_HPP
+#define BOOST_FOREACH_TRACE_HPP
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/foreach.hpp>
+
+#if !defined(BOOST_FOREACH_TRACE)
+# error <boost/foreach_trace.hpp> needs BOOST_FOREACH_TRACE defined before <boost/foreach.hpp>
+#endif
+
+#include <boost/foreach_profile.hpp>
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <ostream>
+#include <algorithm>
+
+#if defined(__linux__)
+# include <unistd.h>
+# include <sys/syscall.h>
+#endif
+
+// The number of spans each thread keeps until they are flushed. Past that,
+// each new span overwrites the oldest.
+#ifndef BOOST_FOREACH_TRACE_CAPACITY
+# define BOOST_FOREACH_TRACE_CAPACITY 4096
+#endif
+
+namespace boost
+{
+
+namespace foreach_detail_
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// trace_event
+//   A loop that ran: its call site, its start and end in nanoseconds of
+//   std::chrono::steady_clock, its iterations, and the thread that ran it.
+struct trace_event
+{
+    std::size_t site;
+    unsigned long long start;
+    unsigned long long end;
+    unsigned long long trips;
+    unsigned long long tid;
+};
+
+struct trace_earlier
+{
+    bool operator()(trace_event const &left, trace_event const &right) const
+    {
+        return left.start < right.start;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// trace_settings
+//   The sampling: loops shorter than threshold nanoseconds are not recorded,
+//   and of the rest each thread records one in every every; none if every is
+//   0.
+struct trace_settings
+{
+    std::atomic<unsigned> every;
+    std::atomic<unsigned long long> threshold;
+
+    static trace_settings &instance()
+    {
+        static trace_settings settings = {{1}, {0}};
+        return settings;
+    }
+};
+
+struct trace_thread;
+
+///////////////////////////////////////////////////////////////////////////////
+// trace_registry
+//   The threads that have recorded a span, and the spans of the threads that
+//   have since exited and not yet been flushed.
+struct trace_registry
+{
+    std::mutex mutex;
+    std::vector<trace_thread *> threads;
+    std::vector<trace_event> retired;
+    unsigned long long next_tid;
+
+    trace_registry()
+      : next_tid(1)
+    {
+    }
+
+    static trace_registry &instance()
+    {
+        static trace_registry registry;
+        return registry;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// trace_thread
+//   The ring buffer of one thread's spans. The thread is its only writer, and
+//   never waits: begun and head count the spans it has started and finished
+//   writing, and flush() reads the slots between the last flush and head, then
+//   drops those that the writer may have begun to overwrite meanwhile. The
+//   slots are atomics written and read with relaxed loads and stores, so that
+//   the reads that lose the race are not undefined behavior.
+struct trace_thread
+{
+    static std::size_t const capacity = BOOST_FOREACH_TRACE_CAPACITY;
+
+    struct slot
+    {
+        std::atomic<unsigned long long> site;
+        std::atomic<unsigned long long> start;
+        std::atomic<unsigned long long> end;
+        std::atomic<unsigned long long> trips;
+    };
+
+    std::unique_ptr<slot[]> slots;
+    std::atomic<unsigned long long> begun;
+    std::atomic<unsigned long long> head;
+    unsigned long long tail;        // the spans flushed, under the registry's mutex
+    unsigned long long tid;
+    unsigned skipped;               // the loops skipped since the last one recorded
+
+    trace_thread()
+      : slots(new slot[capacity])
+      , begun(0)
+      , head(0)
+      , tail(0)
+      , skipped(0)
+    {
+        trace_registry &registry = trace_registry::instance();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+#if defined(__linux__)
+        tid = static_cast<unsigned long long>(::syscall(SYS_gettid));
+#else
+        tid = registry.next_tid++;
+#endif
+        registry.threads.push_back(this);
+    }
+
+    ~trace_thread()
+    {
+        trace_registry &registry = trace_registry::instance();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        take(registry.retired);
+        registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), this));
+    }
+
+    static trace_thread &instance()
+    {
+        static thread_local trace_thread thread;
+        return thread;
+    }
+
+    void push(std::size_t site, unsigned long long start, unsigned long long end, unsigned long long trips)
+    {
+        unsigned long long const n = head.load(std::memory_order_relaxed);
+        begun.store(n + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot &s = slots[n % capacity];
+        s.site.store(site, std::memory_order_relaxed);
+        s.start.store(start, std::memory_order_relaxed);
+        s.end.store(end, std::memory_order_relaxed);
+        s.trips.store(trips, std::memory_order_relaxed);
+        head.store(n + 1, std::memory_order_release);
+    }
+
+    // Appends the spans recorded since the last call to events. Called with
+    // the registry's mutex held.
+    void take(std::vector<trace_event> &events)
+    {
+        unsigned long long const last = head.load(std::memory_order_acquire);
+        unsigned long long first = (std::max)(tail, last > capacity ? last - capacity : 0);
+        std::size_t const size = events.size();
+        for(unsigned long long n = first; n != last; ++n)
+        {
+            slot const &s = slots[n % capacity];
+            trace_event e = {
+                static_cast<std::size_t>(s.site.load(std::memory_order_relaxed))
+              , s.start.load(std::memory_order_relaxed)
+              , s.end.load(std::memory_order_relaxed)
+              , s.trips.load(std::memory_order_relaxed)
+              , tid
+            };
+            events.push_back(e);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        unsigned long long const overwritten = begun.load(std::memory_order_relaxed);
+        if(overwritten > first + capacity)
+        {
+            std::size_t const lost = static_cast<std::size_t>((std::min)(overwritten - capacity, last) - first);
+            events.erase(events.begin() + size, events.begin() + size + lost);
+        }
+        tail = last;
+    }
+};
+
+inline unsigned long long trace_nanoseconds(std::chrono::steady_clock::time_point t)
+{
+    return static_cast<unsigned long long>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count());
+}
+
+inline void trace_span(std::size_t site, std::chrono::steady_clock::time_point start,
+                       std::chrono::steady_clock::time_point end, unsigned long long trips)
+{
+    trace_settings &settings = trace_settings::instance();
+    unsigned const every = settings.every.load(std::memory_order_relaxed);
+    if(0 == every || static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         end - start).count()) < settings.threshold.load(std::memory_order_relaxed))
+        return;
+    trace_thread &thread = trace_thread::instance();
+    if(++thread.skipped < every)
+        return;
+    thread.skipped = 0;
+    thread.push(site, foreach_detail_::trace_nanoseconds(start), foreach_detail_::trace_nanoseconds(end), trips);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// trace_write_string
+//   Writes a JSON string.
+inline void trace_write_string(std::ostream &sout, char const *str)
+{
+    static char const hex[] = "0123456789abcdef";
+    sout << '"';
+    for(; *str; ++str)
+    {
+        unsigned char const ch = static_cast<unsigned char>(*str);
+        if('"' == ch || '\\' == ch)
+            sout << '\\' << *str;
+        else if(ch < 0x20)
+            sout << "\\u00" << hex[ch >> 4] << hex[ch & 0xf];
+        else
+            sout << *str;
+    }
+    sout << '"';
+}
+
+// Writes nanoseconds as the microseconds of the Trace Event format.
+inline void trace_write_microseconds(std::ostream &sout, unsigned long long ns)
+{
+    unsigned long long const fraction = ns % 1000;
+    sout << ns / 1000 << '.' << fraction / 100 << fraction / 10 % 10 << fraction % 10;
+}
+
+} // namespace foreach_detail_
+
+namespace foreach
+{
+namespace trace
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // set_sampling
+    //   Has each thread record one in every every loops that pass the
+    //   threshold, and returns the previous rate. 0 stops the recording; 1,
+    //   the default, records them all.
+    inline unsigned set_sampling(unsigned every)
+    {
+        return foreach_detail_::trace_settings::instance().every.exchange(every);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // set_threshold
+    //   Records only the loops that take at least threshold, and returns the
+    //   previous threshold. The default, 0, records them all.
+    inline std::chrono::nanoseconds set_threshold(std::chrono::nanoseconds threshold)
+    {
+        return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(
+            foreach_detail_::trace_settings::instance().threshold.exchange(
+                static_cast<unsigned long long>((std::max)(threshold.count(), std::chrono::nanoseconds::rep(0))))));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // flush
+    //   Writes the spans recorded since the last flush, on all threads, as a
+    //   Chrome Trace Event JSON object, and returns their number. Each span is
+    //   a complete ("X") event, named for its call site, timed in microseconds
+    //   of std::chrono::steady_clock (CLOCK_MONOTONIC on Linux, as Perfetto's
+    //   own clock), with the loop's type and trip count as its arguments:
+    //
+    //   {"traceEvents":[
+    //   {"name":"main.cpp:42","cat":"BOOST_FOREACH","ph":"X","ts":1234.567,"dur":8.901,
+    //    "pid":4321,"tid":4321,"args":{"type":"std::vector<int>","trips":50}}
+    //   ],"displayTimeUnit":"ns"}
+    //
+    //   Spans overwritten in a full ring buffer before the flush are lost.
+    inline std::size_t flush(std::ostream &sout)
+    {
+        using foreach_detail_::trace_event;
+        std::vector<trace_event> events;
+        {
+            foreach_detail_::trace_registry &registry = foreach_detail_::trace_registry::instance();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            events.swap(registry.retired);
+            for(std::size_t t = 0; t != registry.threads.size(); ++t)
+                registry.threads[t]->take(events);
+        }
+        std::stable_sort(events.begin(), events.end(), foreach_detail_::trace_earlier());
+
+        std::vector<foreach_detail_::profile_site> sites;
+        {
+            foreach_detail_::profile_registry &registry = foreach_detail_::profile_registry::instance();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            sites = registry.sites;
+        }
+
+#if defined(__linux__)
+        unsigned long long const pid = static_cast<unsigned long long>(::getpid());
+#else
+        unsigned long long const pid = 1;
+#endif
+        sout << "{\"traceEvents\":[";
+        for(std::size_t i = 0; i != events.size(); ++i)
+        {
+            trace_event const &e = events[i];
+            foreach_detail_::profile_site const &s = sites[e.site];
+            std::string const name = std::string(s.file) + ':' + std::to_string(s.line);
+            sout << (i ? ",\n" : "\n") << "{\"name\":";
+            foreach_detail_::trace_write_string(sout, name.c_str());
+            sout << ",\"cat\":\"BOOST_FOREACH\",\"ph\":\"X\",\"ts\":";
+            foreach_detail_::trace_write_microseconds(sout, e.start);
+            sout << ",\"dur\":";
+            foreach_detail_::trace_write_microseconds(sout, e.end - e.start);
+            sout << ",\"pid\":" << pid << ",\"tid\":" << e.tid << ",\"args\":{\"type\":";
+            foreach_detail_::trace_write_string(sout, s.type.c_str());
+            sout << ",\"trips\":" << e.trips << "}}";
+        }
+        sout << "\n],\"displayTimeUnit\":\"ns\"}\n";
+        return events.size();
+    }
+} // namespace trace
+} // namespace foreach
+
+} // namespace boost
+
+#endif
@@ -0,0 +1,162 @@
+//  audit.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   17 October 2026 : Initial version.
+*/
+
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_NO_CXX11_LAMBDAS) || defined(BOOST_NO_CXX11_HDR_ATOMIC)                      \
+ || defined(BOOST_NO_CXX11_DECLTYPE) || defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+
+int main()
+{
+    return boost::report_errors();
+}
+
+#else
+
+#define BOOST_FOREACH_AUDIT_COPIES
+
+#include <map>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <boost/array.hpp>
+#include <boost/foreach.hpp>
+#include <boost/range/iterator_range.hpp>
+
+using boost::foreach::audit::copy_record;
+
+///////////////////////////////////////////////////////////////////////////////
+// the copies reported, in order
+std::vector<copy_record> copies;
+
+void record(copy_record const &copy)
+{
+    copies.push_back(copy);
+}
+
+std::vector<int> make_vector()
+{
+    return std::vector<int>(3, 1);
+}
+
+std::vector<int> const make_const_vector()
+{
+    return std::vector<int>(3, 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    BOOST_TEST(&boost::foreach::audit::default_copy_handler == boost::foreach::audit::set_copy_handler(&record));
+
+    int sum = 0;
+    std::vector<int> v(make_vector());
+    std::vector<int> const cv(v);
+
+    // lvalues are not copied
+    BOOST_FOREACH(int i, v)
+        sum += i;
+    BOOST_FOREACH(int i, cv)
+        sum += i;
+    BOOST_REVERSE_FOREACH(int i, v)
+        sum += i;
+    BOOST_TEST(copies.empty());
+
+    // an rvalue is moved into the loop, and a const rvalue copied, each
+    // time the loop runs
+    int const rvalue_line = __LINE__ + 3;
+    for(int k = 0; k != 2; ++k)
+    {
+        BOOST_FOREACH(int i, make_vector())
+            sum += i;
+    }
+    int const const_line = __LINE__ + 1;
+    BOOST_REVERSE_FOREACH(int i, make_const_vector())
+        sum += i;
+
+    BOOST_TEST_EQ(3u, copies.size());
+    if(3u == copies.size())
+    {
+        BOOST_TEST_EQ(std::string(__FILE__), copies[0].file);
+        BOOST_TEST_EQ(rvalue_line, copies[0].line);
+        BOOST_TEST_EQ(sizeof(std::vector<int>), copies[0].size);
+        BOOST_TEST(std::string::npos != std::string(copies[0].type).find("vector"));
+        BOOST_TEST(copies[0].moved);
+        BOOST_TEST(!copies[0].proxy);
+        BOOST_TEST_EQ(1ul, copies[0].count);
+        BOOST_TEST_EQ(rvalue_line, copies[1].line);
+        BOOST_TEST_EQ(2ul, copies[1].count);
+
+        BOOST_TEST_EQ(const_line, copies[2].line);
+        BOOST_TEST(!copies[2].moved);
+        BOOST_TEST(!copies[2].proxy);
+        BOOST_TEST_EQ(1ul, copies[2].count);
+    }
+
+    // a lightweight proxy is copied even when it is an lvalue
+    copies.clear();
+    boost::iterator_range<std::vector<int>::iterator> rng(v);
+    int const proxy_line = __LINE__ + 1;
+    BOOST_FOREACH(int i, rng)
+        sum += i;
+    BOOST_TEST_EQ(1u, copies.size());
+    if(1u == copies.size())
+    {
+        BOOST_TEST_EQ(proxy_line, copies[0].line);
+        BOOST_TEST(copies[0].proxy);
+        BOOST_TEST(!copies[0].moved);
+        BOOST_TEST_EQ(sizeof(rng), copies[0].size);
+    }
+
+    // the other loops report their copies too
+    copies.clear();
+    typedef boost::array<int, 4> array4;
+    BOOST_FOREACH_INDEXED(std::size_t n, int i, array4())
+        sum += i + static_cast<int>(n);
+    typedef std::map<int, int> map_t;
+    map_t m;
+    m[1] = 2;
+    BOOST_FOREACH_KV(int key, int value, map_t(m))
+        sum += key + value;
+    BOOST_FOREACH_ZIP((int i, v)(int j, make_const_vector()))
+        sum += i + j;
+    BOOST_TEST_EQ(3u, copies.size());
+    if(3u == copies.size())
+    {
+        BOOST_TEST_EQ(sizeof(array4), copies[0].size);
+        BOOST_TEST(std::string::npos != std::string(copies[1].type).find("map"));
+        BOOST_TEST(std::string::npos != std::string(copies[2].type).find("vector"));
+        BOOST_TEST(!copies[2].moved);
+    }
+
+    // the reports read as compiler diagnostics do
+    copy_record copy = {"main.cpp", 42, "std::vector<int>", 24, false, false, 1};
+    std::ostringstream sout;
+    boost::foreach::audit::write_copy(sout, copy);
+    BOOST_TEST_EQ(std::string("main.cpp:42: BOOST_FOREACH copied a std::vector<int> (24 bytes), an rvalue\n"), sout.str());
+
+    // and a null handler reports nothing
+    copies.clear();
+    BOOST_TEST(&record == boost::foreach::audit::set_copy_handler(0));
+    BOOST_FOREACH(int i, make_vector())
+        sum += i;
+    BOOST_TEST(copies.empty());
+
+    BOOST_TEST(sum > 0);
+    return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,213 @@
+//  bits.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <bitset>
+#include <vector>
+#include <cstddef>
+#include <boost/mpl/assert.hpp>
+#include <boost/dynamic_bitset.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/foreach.hpp>
+#include <boost/foreach_set_bit.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// every third bit of 200, and the last one, which is in the tail of a word
+std::size_t const nbits = 200;
+
+bool expected(std::size_t i)
+{
+    return 0 == i % 3 || nbits - 1 == i;
+}
+
+template<typename Bits>
+void fill(Bits &bits)
+{
+    for(std::size_t i = 0; i != nbits; ++i)
+        bits[i] = expected(i);
+}
+
+template<typename Bits>
+Bits make()
+{
+    Bits bits;
+    fill(bits);
+    return bits;
+}
+
+template<>
+std::vector<bool> make<std::vector<bool> >()
+{
+    std::vector<bool> bits(nbits);
+    fill(bits);
+    return bits;
+}
+
+template<>
+boost::dynamic_bitset<> make<boost::dynamic_bitset<> >()
+{
+    boost::dynamic_bitset<> bits(nbits);
+    fill(bits);
+    return bits;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// check_set_bits
+//   BOOST_FOREACH_SET_BIT over an lvalue, a const lvalue and an rvalue, with
+//   break and continue
+template<typename Bits>
+void check_set_bits()
+{
+    Bits bits = make<Bits>();
+
+    std::vector<std::size_t> seen;
+    BOOST_FOREACH_SET_BIT(std::size_t i, bits)
+        seen.push_back(i);
+    std::size_t n = 0;
+    for(std::size_t i = 0; i != nbits; ++i)
+    {
+        if(expected(i))
+        {
+            BOOST_TEST(n < seen.size() && i == seen[n]);
+            ++n;
+        }
+    }
+    BOOST_TEST_EQ(n, seen.size());
+    BOOST_TEST_EQ(nbits - 1, seen.back());
+
+    Bits const &cbits = bits;
+    std::size_t sum = 0;
+    BOOST_FOREACH_SET_BIT(std::size_t i, cbits)
+    {
+        if(3 == i)
+            continue;
+        if(99 == i)
+            break;
+        sum += i;
+    }
+    BOOST_TEST_EQ(96u * 33 / 2 - 3, sum);
+
+    std::size_t last = 0;
+    BOOST_FOREACH_SET_BIT(last, make<Bits>())
+    {
+    }
+    BOOST_TEST_EQ(nbits - 1, last);
+
+    // nested loops
+    std::size_t pairs = 0;
+    BOOST_FOREACH_SET_BIT(std::size_t i, bits)
+        BOOST_FOREACH_SET_BIT(std::size_t j, bits)
+            pairs += i < j;
+    BOOST_TEST_EQ(n * (n - 1) / 2, pairs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    // BOOST_FOREACH over a vector<bool> goes an element at a time, unless
+    // BOOST_FOREACH_LIBRARY_SEGMENTS is defined; see segmented_libstdcxx.cpp
+    BOOST_MPL_ASSERT_NOT((boost::foreach::segmented_iterator<std::vector<bool>::iterator>));
+    std::vector<bool> v = make<std::vector<bool> >();
+    std::size_t count = 0;
+    BOOST_FOREACH(bool b, v)
+        count += b;
+    BOOST_TEST_EQ(68u, count);
+
+    // writes through the proxy reference
+    BOOST_FOREACH(std::vector<bool>::reference b, v)
+        b = !b;
+    std::size_t i = 0;
+    BOOST_FOREACH(bool b, v)
+    {
+        BOOST_TEST_EQ(!expected(i), b);
+        ++i;
+    }
+    BOOST_TEST_EQ(nbits, i);
+
+    // break and continue, and a range that starts and ends inside words
+    std::vector<bool> const &cv = v;
+    i = 0;
+    count = 0;
+    BOOST_FOREACH(bool b, cv)
+    {
+        if(++i == 70)
+            continue;
+        if(i == 150)
+            break;
+        count += b;
+    }
+    BOOST_TEST_EQ(149u - 50, count);
+
+    count = 0;
+    BOOST_FOREACH(bool b, boost::make_iterator_range(cv.begin() + 5, cv.end() - 70))
+        count += !b;
+    BOOST_TEST_EQ(42u, count);
+
+    std::vector<bool> none;
+    BOOST_FOREACH(bool b, none)
+    {
+        (void)b;
+        BOOST_TEST(false);
+    }
+
+    // the set bits of each kind of bitset
+    check_set_bits<std::vector<bool> >();
+    check_set_bits<std::bitset<nbits> >();
+    check_set_bits<boost::dynamic_bitset<> >();
+
+    // words whose bits are all set, and bitsets with none
+    std::bitset<130> all;
+    all.set();
+    count = 0;
+    BOOST_FOREACH_SET_BIT(std::size_t j, all)
+        count += j;
+    BOOST_TEST_EQ(129u * 130 / 2, count);
+
+    std::vector<bool> full(130, true);
+    count = 0;
+    BOOST_FOREACH_SET_BIT(std::size_t j, full)
+        count += j;
+    BOOST_TEST_EQ(129u * 130 / 2, count);
+
+    // bits past size() in the last word are not visited
+    full.resize(70);
+    full.resize(130 - 1, false);
+    count = 0;
+    BOOST_FOREACH_SET_BIT(std::size_t j, full)
+        count += j;
+    BOOST_TEST_EQ(69u * 70 / 2, count);
+    full.resize(65);
+    count = 0;
+    BOOST_FOREACH_SET_BIT(std::size_t j, full)
+        count += j < 65;
+    BOOST_TEST_EQ(65u, count);
+
+    BOOST_FOREACH_SET_BIT(std::size_t j, std::bitset<64>())
+    {
+        (void)j;
+        BOOST_TEST(false);
+    }
+    BOOST_FOREACH_SET_BIT(std::size_t j, none)
+    {
+        (void)j;
+        BOOST_TEST(false);
+    }
+    BOOST_FOREACH_SET_BIT(std::size_t j, boost::dynamic_bitset<>())
+    {
+        (void)j;
+        BOOST_TEST(false);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,176 @@
+//  chunk.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <list>
+#include <deque>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <boost/array.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/foreach.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// counted
+//   keeps count of the live instances, so we can check that the gather buffer
+//   destroys what it constructs
+int live = 0;
+
+struct counted
+{
+    counted(int i = 0) : i(i) { ++live; }
+    counted(counted const &that) : i(that.i) { ++live; }
+    ~counted() { --live; }
+    int i;
+};
+
+std::vector<int> get_vector()
+{
+    std::vector<int> v;
+    for(int i = 0; i != 10; ++i)
+        v.push_back(i);
+    return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sizes
+//   the sizes of the chunks, as digits
+template<typename Range>
+std::string sizes(Range const &rng)
+{
+    std::string s;
+    BOOST_FOREACH_CHUNK(boost::foreach::chunk<int const> c, rng, 4)
+        s += static_cast<char>('0' + c.size());
+    return s;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    std::vector<int> v = get_vector();
+    std::list<int> l(v.begin(), v.end());
+    std::deque<int> d(v.begin(), v.end());
+    int arr[10];
+    std::copy(v.begin(), v.end(), arr);
+
+    // every chunk but the last is full, whether the elements are contiguous or not
+    BOOST_TEST_EQ(std::string("442"), sizes(v));
+    BOOST_TEST_EQ(std::string("442"), sizes(l));
+    BOOST_TEST_EQ(std::string("442"), sizes(d));
+    BOOST_TEST_EQ(std::string("442"), sizes(arr));
+    BOOST_TEST_EQ(std::string("44"), sizes(std::vector<int>(8)));
+    BOOST_TEST_EQ(std::string("44"), sizes(std::list<int>(8)));
+    BOOST_TEST_EQ(std::string(""), sizes(std::vector<int>()));
+    BOOST_TEST_EQ(std::string(""), sizes(std::list<int>()));
+
+#if !defined(BOOST_NO_CXX11_DECLTYPE) && !defined(BOOST_NO_SFINAE_EXPR) && !defined(BOOST_FOREACH_NO_CONTIGUOUS)
+    // chunks of contiguous collections refer to the collection's own elements
+    std::size_t offset = 0;
+    bool in_place = true;
+    BOOST_FOREACH_CHUNK(boost::foreach::chunk<int> c, v, 3)
+    {
+        in_place = in_place && c.data() == &v[offset];
+        offset += c.size();
+        BOOST_FOREACH(int &i, c)
+            i *= 2;
+    }
+    BOOST_TEST(in_place);
+    BOOST_TEST_EQ(10u, offset);
+    BOOST_TEST_EQ(18, v[9]);
+#endif
+
+    // ... as do chunks of arrays
+    BOOST_FOREACH_CHUNK(boost::foreach::chunk<int> c, arr, 16)
+    {
+        BOOST_TEST(c.data() == arr);
+        BOOST_TEST_EQ(10u, c.size());
+    }
+
+    // others are gathered, in order
+    std::vector<int> gathered;
+    BOOST_FOREACH_CHUNK(boost::foreach::chunk<int const> c, l, 3)
+        gathered.insert(gathered.end(), c.begin(), c.end());
+    BOOST_TEST(std::vector<int>(l.begin(), l.end()) == gathered);
+
+    // rvalues live as long as the loop
+    int sum = 0;
+    BOOST_FOREACH_CHUNK(boost::foreach::chunk<int const> c, get_vector(), 4)
+    {
+        for(std::size_t i = 0; i != c.size(); ++i)
+            sum += c[i];
+    }
+    BOOST_TEST_EQ(45, sum);
+
+    // proxies and null-terminated strings
+    std::vector<bool> bits(5, true);
+    int set = 0;
+    BOOST_FOREACH_CHUNK(boost::foreach::chunk<bool const> c, bits, 2)
+    {
+        BOOST_FOREACH(bool b, c)
+            set += b;
+    }
+    BOOST_TEST_EQ(5, set);
+
+    std::string s;
+    BOOST_FOREACH_CHUNK(boost::foreach::chunk<char const> c, static_cast<char const *>("hello"), 2)
+        s += std::string(c.begin(), c.end()) + "|";
+    BOOST_TEST_EQ(std::string("he|ll|o|"), s);
+
+    // the buffer destroys the elements it gathers
+    {
+        std::list<counted> counteds(7, counted(1));
+        int const before = live;
+        sum = 0;
+        BOOST_FOREACH_CHUNK(boost::foreach::chunk<counted const> c, counteds, 3)
+        {
+            BOOST_TEST_EQ(before + static_cast<int>(c.size()), live);
+            BOOST_FOREACH(counted const &x, c)
+                sum += x.i;
+        }
+        BOOST_TEST_EQ(before, live);
+        BOOST_TEST_EQ(7, sum);
+    }
+    BOOST_TEST_EQ(0, live);
+
+    // break and continue
+    int chunks = 0;
+    BOOST_FOREACH_CHUNK(boost::foreach::chunk<int const> c, d, 2)
+    {
+        if(0 == c[0])
+            continue;
+        ++chunks;
+        if(4 == c[0])
+            break;
+    }
+    BOOST_TEST_EQ(2, chunks);
+
+    // a predeclared chunk keeps the last one
+    boost::foreach::chunk<int const> last;
+    BOOST_FOREACH_CHUNK(last, l, 4)
+    {
+    }
+    BOOST_TEST_EQ(2u, last.size());
+
+    // boost::array
+    boost::array<int, 5> ba = {{1, 2, 3, 4, 5}};
+    sum = 0;
+    BOOST_FOREACH_CHUNK(boost::foreach::chunk<int> c, ba, 1)
+    {
+        BOOST_TEST_EQ(1u, c.size());
+        sum = sum * 10 + c[0];
+    }
+    BOOST_TEST_EQ(12345, sum);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+#
+# (C) Copyright agent 2026.
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+"""Check that BOOST_FOREACH compiles to the same code as a hand-written loop.
+
+Compiles codegen.cpp to assembly once for each collection type, and once for
+the counting loops over irange(), and compares every foreach_X function with
+its handwritten_X twin. Assertions are compiled out, as in a release build. A pair fails if their
+instruction counts differ by more than the threshold, or if only one of them
+was vectorized. Exits with a non-zero status if any pair fails.
+
+The comparison is only meaningful with optimization enabled (-O2 or -O3); at
+lower levels, and at -Os, the helpers in utility.hpp are not inlined. The
+hand-written loops use auto, so codegen.cpp needs C++11.
+"""
+
+import argparse
+import os
+import re
+import shlex
+import subprocess
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+COLLECTIONS = ['STL', 'VECTOR', 'ARRAY', 'PAIR', 'CSTR', 'IRANGE']
+
+# x86 packed SIMD mnemonics, and AArch64 vector register arrangements
+PACKED = re.compile(r'^v?(p[a-z]|movdq|movup|movap|shufp|unpck|[a-z]+p[sd]$)')
+WIDE_REGISTER = re.compile(r'%[yz]mm\d')
+XMM_REGISTER = re.compile(r'%xmm\d')
+NEON_REGISTER = re.compile(r'\bv\d+\.\d*[bhsd]\b')
+
+
+def functions(asm):
+    """Map each function defined in asm to the list of its instructions."""
+    result = {}
+    current = None
+    for line in asm.splitlines():
+        label = re.match(r'^_?([A-Za-z_][A-Za-z0-9_]*):', line)
+        if label:
+            current = result.setdefault(label.group(1), [])
+            continue
+        if current is None:
+            continue
+        stripped = line.split('#')[0].split('//')[0].strip()
+        if not stripped or stripped.endswith(':'):
+            continue
+        if stripped.startswith('.'):
+            if stripped.startswith('.size') or stripped.startswith('.cfi_endproc'):
+                current = None
+            continue
+        current.append(stripped)
+    return result
+
+
+def resolve(funcs, name):
+    """Follow a function that is nothing but a tail call to another one."""
+    body = funcs[name]
+    while len(body) == 1 and body[0].split()[0] in ('jmp', 'b'):
+        target = body[0].split()[-1].split('@')[0]
+        target = target if target in funcs else target[1:]
+        if target not in funcs or funcs[target] is body:
+            break
+        body = funcs[target]
+    return body
+
+
+def is_vectorized(instructions):
+    for insn in instructions:
+        mnemonic = insn.split()[0]
+        if WIDE_REGISTER.search(insn) or NEON_REGISTER.search(insn):
+            return True
+        if XMM_REGISTER.search(insn) and PACKED.match(mnemonic):
+            return True
+    return False
+
+
+def compile_to_asm(args, collection):
+    command = [args.cxx] + shlex.split(args.flags) + [
+        '-DBOOST_FOREACH_CODEGEN_' + collection,
+        '-DNDEBUG',
+        '-I' + os.path.join(HERE, '..', '..', 'include'),
+        '-fno-asynchronous-unwind-tables',
+        '-S', '-o', '-',
+        os.path.join(HERE, 'codegen.cpp'),
+    ]
+    return subprocess.check_output(command, universal_newlines=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--cxx', default=os.environ.get('CXX', 'c++'),
+                        help='the compiler to test (default: $CXX or c++)')
+    parser.add_argument('--flags', default='-std=c++11 -O2',
+                        help='compiler flags (default: %(default)s)')
+    parser.add_argument('--absolute', type=int, default=6,
+                        help='instructions a pair may always differ by (default: %(default)s)')
+    parser.add_argument('--relative', type=float, default=0.10,
+                        help='fraction of the hand-written loop a pair may differ by (default: %(default)s)')
+    args = parser.parse_args()
+
+    failures = 0
+    for collection in COLLECTIONS:
+        funcs = functions(compile_to_asm(args, collection))
+        for name in sorted(funcs):
+            if not name.startswith('foreach_'):
+                continue
+            twin = 'handwritten_' + name[len('foreach_'):]
+            if twin not in funcs:
+                print('MISSING  %-8s %s' % (collection, twin))
+                failures += 1
+                continue
+            fe, hw = resolve(funcs, name), resolve(funcs, twin)
+            allowed = max(args.absolute, int(args.relative * len(hw)))
+            vec_fe, vec_hw = is_vectorized(fe), is_vectorized(hw)
+            ok = abs(len(fe) - len(hw)) <= allowed and vec_fe == vec_hw
+            print('%-4s %-8s %-26s foreach %4d%s  handwritten %4d%s' % (
+                'ok' if ok else 'FAIL', collection, name[len('foreach_'):],
+                len(fe), ' (vectorized)' if vec_fe else '             ',
+                len(hw), ' (vectorized)' if vec_hw else ''))
+            failures += not ok
+
+    if failures:
+        print('%d function(s) differ from the hand-written loop' % failures)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,400 @@
+//  codegen.cpp
+//
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+// Pairs every loop in ../utility.hpp with the equivalent hand-written loop.
+// check_codegen.py compiles this file once per collection type, selected with
+// BOOST_FOREACH_CODEGEN_<NAME>, and compares the code generated for each pair.
+// Functions named foreach_X are BOOST_FOREACH loops, handwritten_X are not.
+// BOOST_FOREACH_CODEGEN_IRANGE selects the loops over boost::foreach::irange()
+// instead, each paired with the plain integer loop it should compile to.
+
+#include <list>
+#include <vector>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <iterator>
+#include <boost/range/end.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/rend.hpp>
+#include <boost/range/rbegin.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/reverse_iterator.hpp>
+#include <boost/foreach.hpp>
+
+#if defined(BOOST_FOREACH_CODEGEN_IRANGE)
+
+using boost::foreach::irange;
+
+extern "C"
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// counting loops
+void foreach_irange_scale(int *a, int n)
+{
+    BOOST_FOREACH(int i, irange(0, n))
+        a[i] *= 3;
+}
+
+void handwritten_irange_scale(int *a, int n)
+{
+    for(int i = 0; i < n; ++i)
+        a[i] *= 3;
+}
+
+long foreach_irange_sum(int first, int last)
+{
+    long sum = 0;
+    BOOST_FOREACH(int i, irange(first, last))
+        sum += i;
+    return sum;
+}
+
+long handwritten_irange_sum(int first, int last)
+{
+    long sum = 0;
+    for(int i = first; i < last; ++i)
+        sum += i;
+    return sum;
+}
+
+void foreach_irange_stride(float *a, int n)
+{
+    BOOST_FOREACH(int i, irange(0, n, 2))
+        a[i] += 1.0f;
+}
+
+void handwritten_irange_stride(float *a, int n)
+{
+    for(int i = 0; i < n; i += 2)
+        a[i] += 1.0f;
+}
+
+void foreach_irange_down(int *a, int n)
+{
+    BOOST_FOREACH(int i, irange(n - 1, -1, -1))
+        a[i] += i;
+}
+
+void handwritten_irange_down(int *a, int n)
+{
+    for(int i = n - 1; i > -1; --i)
+        a[i] += i;
+}
+
+void foreach_irange_iota_r(int *a, int n)
+{
+    BOOST_REVERSE_FOREACH(int i, irange(0, n))
+        a[i] = i;
+}
+
+// reverse iteration steps back from the end of the half-open range
+void handwritten_irange_iota_r(int *a, int n)
+{
+    for(int i = n; i > 0;)
+    {
+        --i;
+        a[i] = i;
+    }
+}
+
+void foreach_irange_bytes(unsigned char *a, std::size_t n)
+{
+    BOOST_FOREACH(std::size_t i, irange<std::size_t>(0, n))
+        a[i] = static_cast<unsigned char>(a[i] + 1);
+}
+
+void handwritten_irange_bytes(unsigned char *a, std::size_t n)
+{
+    for(std::size_t i = 0; i < n; ++i)
+        a[i] = static_cast<unsigned char>(a[i] + 1);
+}
+
+} // extern "C"
+
+#else
+
+///////////////////////////////////////////////////////////////////////////////
+// define the container types, used by utility.hpp to generate the helper functions
+#if defined(BOOST_FOREACH_CODEGEN_STL)
+typedef std::list<int> foreach_container_type;
+typedef std::list<int> const foreach_const_container_type;
+typedef int foreach_value_type;
+typedef int &foreach_reference_type;
+typedef int const &foreach_const_reference_type;
+#elif defined(BOOST_FOREACH_CODEGEN_VECTOR)
+typedef std::vector<int> foreach_container_type;
+typedef std::vector<int> const foreach_const_container_type;
+typedef int foreach_value_type;
+typedef int &foreach_reference_type;
+typedef int const &foreach_const_reference_type;
+#elif defined(BOOST_FOREACH_CODEGEN_ARRAY)
+typedef int foreach_container_type[5];
+typedef int const foreach_const_container_type[5];
+typedef int foreach_value_type;
+typedef int &foreach_reference_type;
+typedef int const &foreach_const_reference_type;
+#elif defined(BOOST_FOREACH_CODEGEN_PAIR)
+typedef std::pair<int*,int*> foreach_container_type;
+typedef std::pair<int const*,int const*> const foreach_const_container_type;
+typedef int foreach_value_type;
+typedef int &foreach_reference_type;
+typedef int const &foreach_const_reference_type;
+#elif defined(BOOST_FOREACH_CODEGEN_CSTR)
+typedef char *foreach_container_type;
+typedef char const *foreach_const_container_type;
+typedef char foreach_value_type;
+typedef char &foreach_reference_type;
+typedef char const &foreach_const_reference_type;
+#else
+# error define one of BOOST_FOREACH_CODEGEN_STL, _VECTOR, _ARRAY, _PAIR, _CSTR or _IRANGE
+#endif
+
+#include "../utility.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// hand-written iteration; null-terminated strings are measured up front,
+// just as BOOST_FOREACH does
+#if !defined(BOOST_FOREACH_CODEGEN_CSTR)
+template<typename Rng>
+inline typename boost::range_iterator<Rng>::type hw_begin(Rng &rng)
+{
+    return boost::begin(rng);
+}
+
+template<typename Rng>
+inline typename boost::range_iterator<Rng>::type hw_end(Rng &rng)
+{
+    return boost::end(rng);
+}
+
+template<typename Rng>
+inline typename boost::range_reverse_iterator<Rng>::type hw_rbegin(Rng &rng)
+{
+    return boost::rbegin(rng);
+}
+
+template<typename Rng>
+inline typename boost::range_reverse_iterator<Rng>::type hw_rend(Rng &rng)
+{
+    return boost::rend(rng);
+}
+#else
+
+template<typename Char>
+inline Char *hw_begin(Char *const &str)
+{
+    return str;
+}
+
+template<typename Char>
+inline Char *hw_end(Char *const &str)
+{
+    return str + std::strlen(str);
+}
+
+template<typename Char>
+inline boost::reverse_iterator<Char *> hw_rbegin(Char *const &str)
+{
+    return boost::reverse_iterator<Char *>(str + std::strlen(str));
+}
+
+template<typename Char>
+inline boost::reverse_iterator<Char *> hw_rend(Char *const &str)
+{
+    return boost::reverse_iterator<Char *>(str);
+}
+#endif
+
+// the best hand-written indexed loop: random-access collections are walked by
+// the index alone, others advance an iterator in step with it
+template<typename Iter>
+inline long hw_weighted_sum(Iter begin, Iter end, std::random_access_iterator_tag)
+{
+    long sum = 0;
+    for(std::size_t i = 0, n = static_cast<std::size_t>(end - begin); i != n; ++i)
+        sum += begin[i] * static_cast<long>(i);
+    return sum;
+}
+
+template<typename Iter>
+inline long hw_weighted_sum(Iter it, Iter end, std::forward_iterator_tag)
+{
+    long sum = 0;
+    for(std::size_t i = 0; it != end; ++it, ++i)
+        sum += *it * static_cast<long>(i);
+    return sum;
+}
+
+template<typename Iter>
+inline long hw_weighted_sum(Iter begin, Iter end)
+{
+    return hw_weighted_sum(begin, end, typename std::iterator_traits<Iter>::iterator_category());
+}
+
+#define BOOST_FOREACH_CODEGEN_EQUAL(VAR, BEGIN, END)                                            \
+    for(auto it = BEGIN(rng), end = END(rng); it != end; ++it)                       \
+    {                                                                                           \
+        VAR i = *it;                                                                            \
+        if(0 == *result || i != *result)                                                        \
+            return false;                                                                       \
+        ++result;                                                                               \
+    }                                                                                           \
+    return 0 == *result
+
+extern "C"
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// forward
+bool foreach_sequence_equal_byval_n(foreach_container_type &rng, char const *result)
+{
+    return sequence_equal_byval_n(rng, result);
+}
+
+bool handwritten_sequence_equal_byval_n(foreach_container_type &rng, char const *result)
+{
+    BOOST_FOREACH_CODEGEN_EQUAL(foreach_value_type, hw_begin, hw_end);
+}
+
+bool foreach_sequence_equal_byval_c(foreach_const_container_type &rng, char const *result)
+{
+    return sequence_equal_byval_c(rng, result);
+}
+
+bool handwritten_sequence_equal_byval_c(foreach_const_container_type &rng, char const *result)
+{
+    BOOST_FOREACH_CODEGEN_EQUAL(foreach_value_type, hw_begin, hw_end);
+}
+
+bool foreach_sequence_equal_byref_n(foreach_container_type &rng, char const *result)
+{
+    return sequence_equal_byref_n(rng, result);
+}
+
+bool handwritten_sequence_equal_byref_n(foreach_container_type &rng, char const *result)
+{
+    BOOST_FOREACH_CODEGEN_EQUAL(foreach_reference_type, hw_begin, hw_end);
+}
+
+bool foreach_sequence_equal_byref_c(foreach_const_container_type &rng, char const *result)
+{
+    return sequence_equal_byref_c(rng, result);
+}
+
+bool handwritten_sequence_equal_byref_c(foreach_const_container_type &rng, char const *result)
+{
+    BOOST_FOREACH_CODEGEN_EQUAL(foreach_const_reference_type, hw_begin, hw_end);
+}
+
+void foreach_mutate_foreach_byref(foreach_container_type &rng)
+{
+    mutate_foreach_byref(rng);
+}
+
+void handwritten_mutate_foreach_byref(foreach_container_type &rng)
+{
+    for(auto it = hw_begin(rng), end = hw_end(rng); it != end; ++it)
+    {
+        foreach_reference_type i = *it;
+        ++i;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// reverse
+bool foreach_sequence_equal_byval_n_r(foreach_container_type &rng, char const *result)
+{
+    return sequence_equal_byval_n_r(rng, result);
+}
+
+bool handwritten_sequence_equal_byval_n_r(foreach_container_type &rng, char const *result)
+{
+    BOOST_FOREACH_CODEGEN_EQUAL(foreach_value_type, hw_rbegin, hw_rend);
+}
+
+bool foreach_sequence_equal_byval_c_r(foreach_const_container_type &rng, char const *result)
+{
+    return sequence_equal_byval_c_r(rng, result);
+}
+
+bool handwritten_sequence_equal_byval_c_r(foreach_const_container_type &rng, char const *result)
+{
+    BOOST_FOREACH_CODEGEN_EQUAL(foreach_value_type, hw_rbegin, hw_rend);
+}
+
+bool foreach_sequence_equal_byref_n_r(foreach_container_type &rng, char const *result)
+{
+    return sequence_equal_byref_n_r(rng, result);
+}
+
+bool handwritten_sequence_equal_byref_n_r(foreach_container_type &rng, char const *result)
+{
+    BOOST_FOREACH_CODEGEN_EQUAL(foreach_reference_type, hw_rbegin, hw_rend);
+}
+
+bool foreach_sequence_equal_byref_c_r(foreach_const_container_type &rng, char const *result)
+{
+    return sequence_equal_byref_c_r(rng, result);
+}
+
+bool handwritten_sequence_equal_byref_c_r(foreach_const_container_type &rng, char const *result)
+{
+    BOOST_FOREACH_CODEGEN_EQUAL(foreach_const_reference_type, hw_rbegin, hw_rend);
+}
+
+void foreach_mutate_foreach_byref_r(foreach_container_type &rng)
+{
+    mutate_foreach_byref_r(rng);
+}
+
+void handwritten_mutate_foreach_byref_r(foreach_container_type &rng)
+{
+    for(auto it = hw_rbegin(rng), end = hw_rend(rng); it != end; ++it)
+    {
+        foreach_reference_type i = *it;
+        ++i;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// indexed
+long foreach_weighted_sum(foreach_const_container_type &rng)
+{
+    long sum = 0;
+    BOOST_FOREACH_INDEXED(std::size_t i, foreach_value_type x, rng)
+        sum += x * static_cast<long>(i);
+    return sum;
+}
+
+long handwritten_weighted_sum(foreach_const_container_type &rng)
+{
+    return hw_weighted_sum(hw_begin(rng), hw_end(rng));
+}
+
+long foreach_weighted_sum_r(foreach_const_container_type &rng)
+{
+    long sum = 0;
+    BOOST_REVERSE_FOREACH_INDEXED(std::size_t i, foreach_value_type x, rng)
+        sum += x * static_cast<long>(i);
+    return sum;
+}
+
+long handwritten_weighted_sum_r(foreach_const_container_type &rng)
+{
+    return hw_weighted_sum(hw_rbegin(rng), hw_rend(rng));
+}
+
+} // extern "C"
+
+#endif // BOOST_FOREACH_CODEGEN_IRANGE
@@ -0,0 +1,244 @@
+//  contiguous.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <iterator>
+#include <boost/array.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/foreach.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// counting_iterator
+//   counts how many times it has been incremented. BOOST_FOREACH iterates
+//   over contiguous collections with pointers, so it never increments these.
+int increments = 0;
+
+struct counting_iterator
+{
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef int value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef int *pointer;
+    typedef int &reference;
+
+    explicit counting_iterator(int *p = 0) : p(p) {}
+    reference operator*() const { return *p; }
+    reference operator[](difference_type n) const { return p[n]; }
+    counting_iterator &operator++() { ++increments; ++p; return *this; }
+    counting_iterator operator++(int) { counting_iterator tmp(*this); ++*this; return tmp; }
+    counting_iterator &operator--() { ++increments; --p; return *this; }
+    counting_iterator operator--(int) { counting_iterator tmp(*this); --*this; return tmp; }
+    counting_iterator &operator+=(difference_type n) { p += n; return *this; }
+    counting_iterator &operator-=(difference_type n) { p -= n; return *this; }
+    counting_iterator operator+(difference_type n) const { return counting_iterator(p + n); }
+    counting_iterator operator-(difference_type n) const { return counting_iterator(p - n); }
+    difference_type operator-(counting_iterator const &that) const { return p - that.p; }
+    bool operator==(counting_iterator const &that) const { return p == that.p; }
+    bool operator!=(counting_iterator const &that) const { return p != that.p; }
+    bool operator<(counting_iterator const &that) const { return p < that.p; }
+
+    int *p;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// buffer
+//   a contiguous collection with a data() member, which is not enough for it
+//   to be detected as contiguous
+struct buffer
+{
+    typedef counting_iterator iterator;
+    typedef counting_iterator const_iterator;
+
+    buffer() { for(int i = 0; i < 4; ++i) elems[i] = i + 1; }
+    int *data() { return elems; }
+    int const *data() const { return elems; }
+    iterator begin() const { return iterator(const_cast<int *>(elems)); }
+    iterator end() const { return iterator(const_cast<int *>(elems) + 4); }
+
+    int elems[4];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// opted_in
+//   contiguous, and says so
+struct opted_in : buffer
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// opted_out
+//   iterates over its elements in a different order, and says so
+struct opted_out : buffer
+{
+    iterator begin() const { return iterator(const_cast<int *>(elems) + 2); }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// every_other
+//   a strided view, like an Eigen Map with an inner stride: it has a data()
+//   member, and random-access iterators that refer to ints, but it skips
+//   every other element
+struct stride_iterator
+  : boost::iterator_facade<stride_iterator, int, boost::random_access_traversal_tag>
+{
+    explicit stride_iterator(int *p = 0) : p(p) {}
+
+private:
+    friend class boost::iterator_core_access;
+
+    int &dereference() const { return *p; }
+    bool equal(stride_iterator const &that) const { return p == that.p; }
+    void increment() { p += 2; }
+    void decrement() { p -= 2; }
+    void advance(std::ptrdiff_t n) { p += 2 * n; }
+    std::ptrdiff_t distance_to(stride_iterator const &that) const { return (that.p - p) / 2; }
+
+    int *p;
+};
+
+struct every_other
+{
+    typedef stride_iterator iterator;
+    typedef stride_iterator const_iterator;
+
+    every_other(int *elems, std::size_t size) : elems(elems), size(size) {}
+    int *data() const { return elems; }
+    iterator begin() const { return iterator(elems); }
+    iterator end() const { return iterator(elems + 2 * size); }
+
+    int *elems;
+    std::size_t size;
+};
+
+namespace boost { namespace foreach
+{
+    template<>
+    struct is_contiguous<opted_in>
+      : mpl::true_
+    {
+    };
+
+    template<>
+    struct is_contiguous<opted_out>
+      : mpl::false_
+    {
+    };
+}}
+
+std::vector<int> get_vector()
+{
+    return std::vector<int>(3, 7);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    int const data[] = {1, 2, 3, 4, 5};
+
+    // the standard contiguous collections, forward and reverse
+    std::vector<int> v(data, data + 5);
+    std::string s;
+    BOOST_FOREACH(int &i, v)
+        i *= 2;
+    BOOST_REVERSE_FOREACH(int i, v)
+        s += static_cast<char>('0' + i / 2);
+    BOOST_TEST("54321" == s);
+
+    std::string str("abc");
+    BOOST_FOREACH(char &ch, str)
+        ch -= 'a' - 'A';
+    s.clear();
+    BOOST_REVERSE_FOREACH(char ch, static_cast<std::string const &>(str))
+        s += ch;
+    BOOST_TEST("ABC" == str && "CBA" == s);
+
+    boost::array<int, 3> arr = {{1, 2, 3}};
+    int sum = 0;
+    BOOST_FOREACH(int i, arr)
+        sum = sum * 10 + i;
+    BOOST_REVERSE_FOREACH(int i, arr)
+        sum = sum * 10 + i;
+    BOOST_TEST(123321 == sum);
+
+    // rvalues, empty collections and break
+    sum = 0;
+    BOOST_FOREACH(int i, get_vector())
+        sum += i;
+    BOOST_TEST(21 == sum);
+
+    std::vector<int> empty;
+    BOOST_FOREACH(int i, empty)
+    {
+        (void)i;
+        BOOST_TEST(false);
+    }
+    BOOST_REVERSE_FOREACH(int i, empty)
+    {
+        (void)i;
+        BOOST_TEST(false);
+    }
+
+    int last = 0;
+    BOOST_FOREACH(last, v)
+    {
+        if(6 == last)
+            break;
+    }
+    BOOST_TEST(6 == last);
+
+    // user-defined collections that opt in are iterated with pointers
+    opted_in in;
+    increments = 0;
+    sum = 0;
+    BOOST_FOREACH(int i, in)
+        sum = sum * 10 + i;
+    BOOST_REVERSE_FOREACH(int i, in)
+        sum = sum * 10 + i;
+    BOOST_TEST(12344321 == sum);
+#if !defined(BOOST_FOREACH_NO_CONTIGUOUS)
+    BOOST_TEST(0 == increments);
+#endif
+
+    // ... but a data() member is no proof that a collection is contiguous
+    buffer buf;
+    increments = 0;
+    sum = 0;
+    BOOST_FOREACH(int i, buf)
+        sum = sum * 10 + i;
+    BOOST_TEST(1234 == sum);
+    BOOST_TEST(4 == increments);
+
+    int strided[] = {0, 100, 1, 100, 2, 100};
+    sum = 0;
+    BOOST_FOREACH(int i, every_other(strided, 3))
+        sum += i;
+    BOOST_REVERSE_FOREACH(int i, every_other(strided, 3))
+        sum = sum * 10 + i;
+    BOOST_TEST(3210 == sum);
+
+    // collections that opt out use their own iterators
+    opted_out out;
+    increments = 0;
+    sum = 0;
+    BOOST_FOREACH(int i, out)
+        sum = sum * 10 + i;
+    BOOST_TEST(34 == sum);
+    BOOST_TEST(2 == increments);
+
+    return boost::report_errors();
+}
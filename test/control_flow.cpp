@@ -0,0 +1,121 @@
+//  control_flow.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <list>
+#include <vector>
+#include <iterator>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/foreach.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// counting_iterator
+//   counts how many times it has been incremented, so we can check that
+//   BOOST_FOREACH never advances past the element the loop body broke on
+int increments = 0;
+
+struct counting_iterator
+{
+    typedef std::forward_iterator_tag iterator_category;
+    typedef int value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef int const *pointer;
+    typedef int const &reference;
+
+    explicit counting_iterator(int const *p = 0) : p(p) {}
+    reference operator*() const { return *p; }
+    counting_iterator &operator++() { ++increments; ++p; return *this; }
+    counting_iterator operator++(int) { counting_iterator tmp(*this); ++*this; return tmp; }
+    bool operator==(counting_iterator const &that) const { return p == that.p; }
+    bool operator!=(counting_iterator const &that) const { return p != that.p; }
+
+    int const *p;
+};
+
+int const data[] = {1, 2, 3, 4, 5};
+
+std::pair<counting_iterator, counting_iterator> make_counting_range()
+{
+    return std::make_pair(counting_iterator(data), counting_iterator(data + 5));
+}
+
+int find_first_even(std::list<int> const &l)
+{
+    BOOST_FOREACH(int i, l)
+    {
+        if(0 == i % 2)
+            return i;
+    }
+    return -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    // break must not advance the iterator
+    increments = 0;
+    BOOST_FOREACH(int i, make_counting_range())
+    {
+        if(3 == i)
+            break;
+    }
+    BOOST_TEST(2 == increments);
+
+    // continue goes on to the next element
+    int sum = 0;
+    BOOST_FOREACH(int i, data)
+    {
+        if(0 == i % 2)
+            continue;
+        sum += i;
+    }
+    BOOST_TEST(9 == sum);
+
+    // predeclared loop variable keeps its last value
+    int last = 0;
+    BOOST_FOREACH(last, data)
+    {
+        if(4 == last)
+            break;
+    }
+    BOOST_TEST(4 == last);
+
+    BOOST_REVERSE_FOREACH(last, data)
+    {
+    }
+    BOOST_TEST(1 == last);
+
+    // return from within the loop body
+    std::list<int> l(data, data + 5);
+    BOOST_TEST(2 == find_first_even(l));
+
+    // nested loops with break in the inner loop
+    std::vector<std::vector<int> > matrix(3, std::vector<int>(data, data + 5));
+    int count = 0;
+    BOOST_FOREACH(std::vector<int> const &row, matrix)
+        BOOST_FOREACH(int i, row)
+        {
+            if(3 == i)
+                break;
+            ++count;
+        }
+    BOOST_TEST(6 == count);
+
+    // mutate a null-terminated string through a reference
+    char str[] = "abc";
+    BOOST_FOREACH(char &ch, static_cast<char *>(str))
+        ch -= 'a' - 'A';
+    BOOST_TEST(str[0] == 'A' && str[1] == 'B' && str[2] == 'C' && str[3] == '\0');
+
+    return boost::report_errors();
+}
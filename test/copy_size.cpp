@@ -0,0 +1,69 @@
+//  copy_size.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   17 October 2026 : Initial version.
+*/
+
+// With BOOST_FOREACH_MAX_COPY_SIZE, loops over lvalues, over lightweight
+// proxies and over small rvalues compile as before, however large the
+// collection they refer to. See copy_size_fail.cpp for what does not.
+#define BOOST_FOREACH_MAX_COPY_SIZE 64
+
+#include <vector>
+#include <boost/array.hpp>
+#include <boost/foreach.hpp>
+#include <boost/range/iterator_range.hpp>
+
+typedef boost::array<int, 100> big_array;
+
+// a lightweight proxy larger than the limit
+struct big_proxy
+  : boost::iterator_range<int const *>
+{
+    big_proxy(int const *first, int const *last)
+      : boost::iterator_range<int const *>(first, last)
+    {
+    }
+
+    char padding[128];
+};
+
+inline boost::mpl::true_ *boost_foreach_is_lightweight_proxy(big_proxy *&, boost::foreach::tag)
+{
+    return 0;
+}
+
+std::vector<int> make_vector()
+{
+    return std::vector<int>(3, 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// main
+//
+int main( int, char*[] )
+{
+    int sum = 0;
+
+    big_array a = {{0}};
+    BOOST_FOREACH( int i, a ) { sum += i; }
+    BOOST_REVERSE_FOREACH( int i, a ) { sum += i; }
+
+    big_array const ca = {{0}};
+    BOOST_FOREACH( int i, ca ) { sum += i; }
+
+    int data[100] = {0};
+    BOOST_FOREACH( int i, data ) { sum += i; }
+    BOOST_FOREACH( int i, big_proxy(data, data + 100) ) { sum += i; }
+
+    BOOST_FOREACH( int i, make_vector() ) { sum += i; }
+    BOOST_FOREACH_INDEXED( std::size_t n, int i, make_vector() ) { sum += i + static_cast<int>(n); }
+
+    return 9 == sum ? 0 : 1;
+}
@@ -0,0 +1,42 @@
+//  copy_size_fail.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   17 October 2026 : Initial version.
+*/
+
+// With BOOST_FOREACH_MAX_COPY_SIZE, a loop over an rvalue larger than the
+// limit does not compile.
+#define BOOST_FOREACH_MAX_COPY_SIZE 64
+
+#include <boost/array.hpp>
+#include <boost/foreach.hpp>
+
+#ifndef BOOST_FOREACH_COMPILE_TIME_CONST_RVALUE_DETECTION
+// Rvalues are only told from lvalues at run time here, so there is nothing to
+// check; fail regardless.
+# error this compiler detects rvalues at run time
+#endif
+
+typedef boost::array<int, 100> big_array;
+
+big_array make_array()
+{
+    big_array a = {{0}};
+    return a;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// main
+//
+int main( int, char*[] )
+{
+    int sum = 0;
+    BOOST_FOREACH( int i, make_array() ) { sum += i; }
+    return sum;
+}
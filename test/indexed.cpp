@@ -0,0 +1,163 @@
+//  indexed.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <list>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <iterator>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/foreach.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// counting_iterator
+//   counts how many times it has been incremented, so we can check that
+//   BOOST_FOREACH_INDEXED never advances past the element the loop body broke on
+int increments = 0;
+
+struct counting_iterator
+{
+    typedef std::forward_iterator_tag iterator_category;
+    typedef int value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef int const *pointer;
+    typedef int const &reference;
+
+    explicit counting_iterator(int const *p = 0) : p(p) {}
+    reference operator*() const { return *p; }
+    counting_iterator &operator++() { ++increments; ++p; return *this; }
+    counting_iterator operator++(int) { counting_iterator tmp(*this); ++*this; return tmp; }
+    bool operator==(counting_iterator const &that) const { return p == that.p; }
+    bool operator!=(counting_iterator const &that) const { return p != that.p; }
+
+    int const *p;
+};
+
+int const data[] = {1, 2, 3, 4, 5};
+
+std::pair<counting_iterator, counting_iterator> make_counting_range()
+{
+    return std::make_pair(counting_iterator(data), counting_iterator(data + 5));
+}
+
+std::vector<int> get_vector()
+{
+    return std::vector<int>(data, data + 5);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sum_indexed
+//   sums index * element, in both directions
+template<typename Range>
+int sum_indexed(Range const &rng)
+{
+    int sum = 0;
+    BOOST_FOREACH_INDEXED(std::size_t i, int x, rng)
+        sum += static_cast<int>(i) * x;
+    BOOST_REVERSE_FOREACH_INDEXED(std::size_t i, int x, rng)
+        sum = sum * 10 + static_cast<int>(i) * x;
+    return sum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    // 0*1 + 1*2 + 2*3 + 3*4 + 4*5 == 40, then 0*5, 1*4, 2*3, 3*2, 4*1 as digits
+    int const expected = ((((40 * 10 + 0) * 10 + 4) * 10 + 6) * 10 + 6) * 10 + 4;
+
+    // random-access and other collections give the same indices
+    std::vector<int> v(data, data + 5);
+    std::list<int> l(data, data + 5);
+    BOOST_TEST(expected == sum_indexed(v));
+    BOOST_TEST(expected == sum_indexed(l));
+    BOOST_TEST(expected == sum_indexed(data));
+
+    // forward-only and rvalue collections
+    int sum = 0;
+    BOOST_FOREACH_INDEXED(std::size_t i, int x, make_counting_range())
+        sum += static_cast<int>(i) * x;
+    BOOST_TEST(40 == sum);
+
+    sum = 0;
+    BOOST_FOREACH_INDEXED(std::size_t i, int x, get_vector())
+        sum += static_cast<int>(i) * x;
+    BOOST_TEST(40 == sum);
+
+    // mutate through a reference
+    BOOST_FOREACH_INDEXED(std::size_t i, int &x, v)
+        x += static_cast<int>(i);
+    BOOST_REVERSE_FOREACH_INDEXED(std::size_t i, int &x, l)
+        x += static_cast<int>(i);
+    BOOST_TEST(1 == v[0] && 3 == v[1] && 9 == v[4]);
+    BOOST_TEST(std::list<int>(5, 5) == l);
+
+    // null-terminated strings
+    std::string s;
+    BOOST_FOREACH_INDEXED(std::size_t i, char ch, static_cast<char const *>("abc"))
+        s += static_cast<char>(ch + i);
+    BOOST_REVERSE_FOREACH_INDEXED(std::size_t i, char ch, static_cast<char const *>("abc"))
+        s += static_cast<char>(ch + i);
+    BOOST_TEST("aceccc" == s);
+
+    // proxy references
+    std::vector<bool> bits(4, false);
+    BOOST_FOREACH_INDEXED(std::size_t i, std::vector<bool>::reference b, bits)
+        b = (1 == i % 2);
+    BOOST_TEST(!bits[0] && bits[1] && !bits[2] && bits[3]);
+
+    // break must not advance the iterator, and predeclared variables keep their last values
+    std::size_t idx = 0;
+    int last = 0;
+    increments = 0;
+    BOOST_FOREACH_INDEXED(idx, last, make_counting_range())
+    {
+        if(3 == last)
+            break;
+    }
+    BOOST_TEST(2 == increments);
+    BOOST_TEST(2 == idx && 3 == last);
+
+    BOOST_REVERSE_FOREACH_INDEXED(idx, last, v)
+    {
+        if(3 == last)
+            break;
+    }
+    BOOST_TEST(3 == idx);
+
+    BOOST_FOREACH_INDEXED(idx, last, data)
+    {
+    }
+    BOOST_TEST(4 == idx && 5 == last);
+
+    // continue goes on to the next element, and the index with it
+    sum = 0;
+    BOOST_FOREACH_INDEXED(std::size_t i, int x, l)
+    {
+        if(0 == i % 2)
+            continue;
+        sum += x;
+    }
+    BOOST_TEST(10 == sum);
+
+    // empty collections
+    std::vector<int> empty;
+    BOOST_FOREACH_INDEXED(std::size_t i, int x, empty)
+    {
+        (void)i;
+        (void)x;
+        BOOST_TEST(false);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,150 @@
+//  irange.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <vector>
+#include <climits>
+#include <cstddef>
+#include <boost/range/size.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/foreach.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+using boost::foreach::irange;
+
+///////////////////////////////////////////////////////////////////////////////
+// collect
+//   the integers of a range, by BOOST_FOREACH and by BOOST_REVERSE_FOREACH
+template<typename T>
+std::vector<T> collect(boost::foreach::integer_range<T> const &rng)
+{
+    std::vector<T> result;
+    BOOST_FOREACH(T i, rng)
+        result.push_back(i);
+    return result;
+}
+
+template<typename T>
+std::vector<T> collect_r(boost::foreach::integer_range<T> const &rng)
+{
+    std::vector<T> result;
+    BOOST_REVERSE_FOREACH(T i, rng)
+        result.push_back(i);
+    return result;
+}
+
+template<typename T>
+std::vector<T> make(T a, T b, T c, T d)
+{
+    std::vector<T> result;
+    result.push_back(a);
+    result.push_back(b);
+    result.push_back(c);
+    result.push_back(d);
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    // counting up, by value, by const reference and predeclared
+    int sum = 0;
+    BOOST_FOREACH(int i, irange(0, 10))
+        sum += i;
+    BOOST_TEST_EQ(45, sum);
+
+    sum = 0;
+    BOOST_FOREACH(int const &i, irange(-5, 5))
+        sum += i;
+    BOOST_TEST_EQ(-5, sum);
+
+    int last = 0;
+    BOOST_FOREACH(last, irange(3, 8))
+    {
+    }
+    BOOST_TEST_EQ(7, last);
+
+    // steps up and down, which need not land on last
+    BOOST_TEST(make(0, 3, 6, 9) == collect(irange(0, 10, 3)));
+    BOOST_TEST(make(0, 3, 6, 9) == collect(irange(0, 12, 3)));
+    BOOST_TEST(make(10, 7, 4, 1) == collect(irange(10, 0, -3)));
+    BOOST_TEST(make(3, 2, 1, 0) == collect(irange(3, -1, -1)));
+    BOOST_TEST_EQ(4u, irange(10, 0, -3).size());
+    BOOST_TEST_EQ(4u, boost::size(irange(0, 12, 3)));
+
+    // reverse iteration
+    BOOST_TEST(make(3, 2, 1, 0) == collect_r(irange(0, 4)));
+    BOOST_TEST(make(9, 6, 3, 0) == collect_r(irange(0, 10, 3)));
+    BOOST_TEST(make(1, 4, 7, 10) == collect_r(irange(10, 0, -3)));
+
+    // empty ranges: last not after first, or a step the wrong way
+    BOOST_TEST(collect(irange(5, 5)).empty());
+    BOOST_TEST(collect(irange(5, 2)).empty());
+    BOOST_TEST(collect(irange(2, 5, -1)).empty());
+    BOOST_TEST(collect_r(irange(5, 2)).empty());
+    BOOST_TEST(irange(7, 3).empty());
+    BOOST_TEST_EQ(0u, irange(7, 3).size());
+
+    // break and continue
+    sum = 0;
+    BOOST_FOREACH(int i, irange(0, 100))
+    {
+        if(i % 2)
+            continue;
+        if(i > 10)
+            break;
+        sum += i;
+    }
+    BOOST_TEST_EQ(30, sum);
+
+    // indexed, nested and as a random-access range
+    std::size_t weighted = 0;
+    BOOST_FOREACH_INDEXED(std::size_t n, int i, irange(10, 40, 10))
+        weighted += n * static_cast<std::size_t>(i);
+    BOOST_TEST_EQ(0u * 10 + 1 * 20 + 2 * 30, weighted);
+
+    int pairs = 0;
+    BOOST_FOREACH(int i, irange(0, 5))
+        BOOST_FOREACH(int j, irange(i + 1, 5))
+            pairs += j > i;
+    BOOST_TEST_EQ(10, pairs);
+
+    boost::foreach::integer_range<int> const r = irange(1, 20, 4);
+    BOOST_TEST_EQ(5, boost::end(r) - boost::begin(r));
+    BOOST_TEST_EQ(13, boost::begin(r)[3]);
+    BOOST_TEST_EQ(17, r[4]);
+    BOOST_TEST_EQ(17, *(boost::end(r) - 1));
+    BOOST_TEST(boost::begin(r) < boost::end(r));
+
+    // other integer types, and the ends of their ranges
+    BOOST_TEST(make<unsigned>(0, 3, 6, 9) == collect(irange(0u, 11u, 3u)));
+    BOOST_TEST(make<short>(32763, 32764, 32765, 32766) == collect(irange<short>(32763, 32767)));
+    BOOST_TEST(make<short>(-32764, -32765, -32766, -32767) == collect(irange<short>(-32764, -32768, -1)));
+    BOOST_TEST(make<signed char>(-128, -96, -64, -32) == collect(irange<signed char>(-128, 0, 32)));
+    BOOST_TEST(make<unsigned char>(254, 253, 252, 251) == collect_r(irange<unsigned char>(251, 255)));
+    BOOST_TEST_EQ(UINT_MAX, irange(INT_MIN, INT_MAX).size());
+    BOOST_TEST_EQ(INT_MAX - 1, *(irange(INT_MIN, INT_MAX).end() - 1));
+
+    long long big = 0;
+    BOOST_FOREACH(long long i, irange(LLONG_MAX - 3, LLONG_MAX))
+        big = i;
+    BOOST_TEST_EQ(LLONG_MAX - 1, big);
+
+    std::size_t count = 0;
+    BOOST_FOREACH(std::size_t i, irange<std::size_t>(0, 1000))
+        count += i;
+    BOOST_TEST_EQ(999u * 1000 / 2, count);
+
+    return boost::report_errors();
+}
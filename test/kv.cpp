@@ -0,0 +1,165 @@
+//  kv.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <map>
+#include <string>
+#include <vector>
+#include <utility>
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/foreach.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_UNORDERED_MAP
+# include <unordered_map>
+#endif
+
+typedef std::map<std::string, int> map_t;
+
+map_t get_map()
+{
+    map_t m;
+    m["one"] = 1;
+    m["two"] = 2;
+    m["three"] = 3;
+    return m;
+}
+
+std::pair<int, int> square(int i)
+{
+    return std::make_pair(i, i * i);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// describe
+//   the keys and values of a range of pairs, in order
+template<typename Range>
+std::string describe(Range const &rng)
+{
+    std::string s;
+    BOOST_FOREACH_KV(std::string const &key, int value, rng)
+        s += key + "=" + static_cast<char>('0' + value) + " ";
+    return s;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    map_t m = get_map();
+    map_t const &cm = m;
+
+    BOOST_TEST_EQ(std::string("one=1 three=3 two=2 "), describe(m));
+    BOOST_TEST_EQ(std::string("one=1 three=3 two=2 "), describe(get_map()));
+
+    // the key and the value refer to the members of the pair in the map
+    bool in_place = true;
+    BOOST_FOREACH_KV(std::string const &key, int &value, m)
+    {
+        map_t::value_type &pair = *m.find(key);
+        in_place = in_place && &key == &pair.first && &value == &pair.second;
+        value *= 10;
+    }
+    BOOST_TEST(in_place);
+    BOOST_TEST_EQ(10, m["one"]);
+    BOOST_TEST_EQ(20, m["two"]);
+    BOOST_TEST_EQ(30, m["three"]);
+
+    // ... and are const if the map is
+    in_place = true;
+    BOOST_FOREACH_KV(std::string const &key, int const &value, cm)
+        in_place = in_place && &value == &cm.find(key)->second;
+    BOOST_TEST(in_place);
+
+    // multimaps, and ranges of pairs of iterators into them
+    std::multimap<int, std::string> mm;
+    mm.insert(std::make_pair(1, std::string("a")));
+    mm.insert(std::make_pair(2, std::string("b")));
+    mm.insert(std::make_pair(2, std::string("c")));
+    mm.insert(std::make_pair(3, std::string("d")));
+    std::string s;
+    BOOST_FOREACH_KV(int key, std::string &value, mm.equal_range(2))
+    {
+        s += value;
+        value += static_cast<char>('0' + key);
+    }
+    BOOST_TEST_EQ(std::string("bc"), s);
+    s.clear();
+    BOOST_FOREACH_KV(int key, std::string const &value, mm)
+        s += value + static_cast<char>('0' + key);
+    BOOST_TEST_EQ(std::string("a1b22c22d3"), s);
+
+#ifndef BOOST_NO_CXX11_HDR_UNORDERED_MAP
+    std::unordered_map<std::string, int> um(m.begin(), m.end());
+    int sum = 0;
+    BOOST_FOREACH_KV(std::string const &key, int &value, um)
+    {
+        sum += value;
+        value = static_cast<int>(key.size());
+    }
+    BOOST_TEST_EQ(60, sum);
+    BOOST_TEST_EQ(5, um["three"]);
+#endif
+
+    // sequences of pairs
+    std::vector<std::pair<int, int> > v;
+    for(int i = 0; i != 5; ++i)
+        v.push_back(std::make_pair(i, i * i));
+    BOOST_FOREACH_KV(int &key, int &value, v)
+        std::swap(key, value);
+    BOOST_TEST_EQ(16, v[4].first);
+    BOOST_TEST_EQ(4, v[4].second);
+
+    // iterators that return pairs by value yield the key and value by value
+    int squares[] = {0, 1, 2, 3};
+    int total = 0;
+    BOOST_FOREACH_KV(int key, int const &value, std::make_pair(
+        boost::make_transform_iterator(squares + 0, &square),
+        boost::make_transform_iterator(squares + 4, &square)))
+    {
+        total += key * 100 + value;
+    }
+    BOOST_TEST_EQ(614, total);
+
+    // break and continue
+    int visited = 0;
+    BOOST_FOREACH_KV(int key, int value, v)
+    {
+        (void)value;
+        if(0 == key)
+            continue;
+        ++visited;
+        if(9 == key)
+            break;
+    }
+    BOOST_TEST_EQ(3, visited);
+
+    // predeclared variables keep the last pair
+    std::string last_key;
+    int last_value = 0;
+    BOOST_FOREACH_KV(last_key, last_value, cm)
+    {
+    }
+    BOOST_TEST_EQ(std::string("two"), last_key);
+    BOOST_TEST_EQ(20, last_value);
+
+    // empty maps
+    BOOST_FOREACH_KV(std::string const &key, int value, map_t())
+    {
+        (void)key;
+        (void)value;
+        BOOST_TEST(false);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,171 @@
+//  lite.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <map>
+#include <list>
+#include <string>
+#include <vector>
+#include <utility>
+#include <boost/foreach_lite.hpp>
+
+// foreach_lite.hpp must not drag in the rest of Boost
+#if !defined(BOOST_FOREACH_LITE_UNSUPPORTED)                                                    \
+ && (defined(BOOST_CONFIG_HPP) || defined(BOOST_MPL_IF_HPP_INCLUDED) || defined(BOOST_RANGE_BEGIN_HPP))
+# error foreach_lite.hpp includes more than the standard library
+#endif
+
+#include <boost/core/lightweight_test.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// a user-defined collection that extends Boost.Range with range_begin/range_end
+namespace mine
+{
+    struct digits
+    {
+        int data[3];
+    };
+
+    int *range_begin(digits &d) { return d.data; }
+    int const *range_begin(digits const &d) { return d.data; }
+    int *range_end(digits &d) { return d.data + 3; }
+    int const *range_end(digits const &d) { return d.data + 3; }
+}
+
+#ifdef BOOST_FOREACH_LITE_UNSUPPORTED
+// Boost.Range also wants to be told the iterator types
+namespace boost
+{
+    template<>
+    struct range_mutable_iterator<mine::digits>
+    {
+        typedef int * type;
+    };
+
+    template<>
+    struct range_const_iterator<mine::digits>
+    {
+        typedef int const * type;
+    };
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// counted
+//   a collection that counts how many times it has been copied
+int copies = 0;
+
+struct counted : std::vector<int>
+{
+    counted() : std::vector<int>(3, 1) {}
+    counted(counted const &that) : std::vector<int>(that) { ++copies; }
+#if !defined(BOOST_FOREACH_LITE_UNSUPPORTED)
+    counted(counted &&that) : std::vector<int>(static_cast<std::vector<int> &&>(that)) {}
+#endif
+};
+
+counted get_counted()
+{
+    return counted();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    int const data[] = {1, 2, 3};
+
+    // STL containers, by value and by reference
+    std::list<int> l(data, data + 3);
+    int sum = 0;
+    BOOST_FOREACH(int i, l)
+        sum += i;
+    BOOST_FOREACH(int &i, l)
+        i *= 10;
+    BOOST_REVERSE_FOREACH(int const &i, l)
+        sum = sum * 100 + i;
+    BOOST_TEST(6302010 == sum);
+
+    std::map<int, int> m;
+    m[1] = 2;
+    m[3] = 4;
+    sum = 0;
+    typedef std::pair<int const, int> pair_t;
+    BOOST_FOREACH(pair_t const &p, m)
+        sum += p.first * p.second;
+    BOOST_TEST(14 == sum);
+
+    // arrays
+    std::string s;
+    BOOST_REVERSE_FOREACH(int i, data)
+        s += static_cast<char>('0' + i);
+    BOOST_TEST("321" == s);
+
+    // null-terminated strings
+    char const *cstr = "abc";
+    s.clear();
+    BOOST_FOREACH(char ch, cstr)
+        s += ch;
+    BOOST_REVERSE_FOREACH(char ch, cstr)
+        s += ch;
+    BOOST_TEST("abccba" == s);
+
+    wchar_t wstr[] = L"xy";
+    std::wstring ws;
+    BOOST_FOREACH(wchar_t &ch, static_cast<wchar_t *>(wstr))
+        ws += ch++;
+    BOOST_TEST(L"xy" == ws && L'y' == wstr[0] && L'z' == wstr[1]);
+
+    // iterator pairs
+    std::vector<int> v(data, data + 3);
+    sum = 0;
+    BOOST_FOREACH(int i, std::make_pair(v.begin() + 1, v.end()))
+        sum += i;
+    BOOST_TEST(5 == sum);
+
+    // user-defined collections
+    mine::digits d = {{4, 5, 6}};
+    mine::digits const &cd = d;
+    sum = 0;
+    BOOST_FOREACH(int i, cd)
+        sum = sum * 10 + i;
+    BOOST_REVERSE_FOREACH(int &i, d)
+        sum = sum * 10 + i;
+    BOOST_TEST(456654 == sum);
+
+    // rvalue collections are moved, lvalues are used in place
+    copies = 0;
+    sum = 0;
+    BOOST_FOREACH(int i, get_counted())
+        sum += i;
+    counted c;
+    BOOST_REVERSE_FOREACH(int i, c)
+        sum += i;
+    BOOST_TEST(6 == sum);
+#if !defined(BOOST_FOREACH_LITE_UNSUPPORTED)
+    BOOST_TEST(0 == copies);
+#endif
+
+    // break, continue and a predeclared loop variable
+    int last = 0;
+    BOOST_FOREACH(last, data)
+    {
+        if(1 == last)
+            continue;
+        if(2 == last)
+            break;
+        BOOST_TEST(false);
+    }
+    BOOST_TEST(2 == last);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,153 @@
+//  noexcept.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <vector>
+#include <cstddef>
+#include <iterator>
+#include <boost/config.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/declval.hpp>
+#include <boost/foreach.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// fragile
+//   a collection whose iterator throws when it is incremented past a given
+//   element, but not when it is compared or dereferenced, and which counts its
+//   live copies
+int live = 0;
+
+struct fragile_error
+{
+};
+
+struct fragile_iterator
+{
+    typedef std::forward_iterator_tag iterator_category;
+    typedef int value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef int const *pointer;
+    typedef int const &reference;
+
+    fragile_iterator(int const *p = 0, int const *fail = 0) : p(p), fail(fail) {}
+    reference operator*() const BOOST_NOEXCEPT { return *p; }
+    fragile_iterator &operator++() { if(p == fail) throw fragile_error(); ++p; return *this; }
+    bool operator==(fragile_iterator const &that) const BOOST_NOEXCEPT { return p == that.p; }
+    bool operator!=(fragile_iterator const &that) const BOOST_NOEXCEPT { return p != that.p; }
+
+    int const *p;
+    int const *fail;
+};
+
+struct fragile
+{
+    typedef fragile_iterator iterator;
+    typedef fragile_iterator const_iterator;
+
+    fragile(int const *first, int const *last, int const *fail) : first(first), last(last), fail(fail) { ++live; }
+    fragile(fragile const &that) : first(that.first), last(that.last), fail(that.fail) { ++live; }
+    ~fragile() { --live; }
+
+    iterator begin() const { return iterator(first, fail); }
+    iterator end() const { return iterator(last, fail); }
+
+    int const *first;
+    int const *last;
+    int const *fail;
+};
+
+#ifndef BOOST_FOREACH_NO_NOEXCEPT
+///////////////////////////////////////////////////////////////////////////////
+// the exception specifications of the classic expansion, which follow the
+// collection's iterators
+template<typename T>
+boost::foreach_detail_::type2type<T> *ty() noexcept;
+
+boost::foreach_detail_::auto_any_t any() noexcept;
+
+BOOST_STATIC_ASSERT(noexcept(boost::foreach_detail_::done(any(), any(), ty<std::vector<int> >())));
+BOOST_STATIC_ASSERT(noexcept(boost::foreach_detail_::next(any(), ty<std::vector<int> >())));
+BOOST_STATIC_ASSERT(noexcept(boost::foreach_detail_::deref(any(), ty<std::vector<int> >())));
+BOOST_STATIC_ASSERT(noexcept(boost::foreach_detail_::done(any(), any(), ty<int[4]>())));
+BOOST_STATIC_ASSERT(noexcept(boost::foreach_detail_::next(any(), ty<char const *>())));
+BOOST_STATIC_ASSERT(noexcept(boost::foreach_detail_::end(any(), ty<char const *>(), (boost::mpl::true_ *)0)));
+
+BOOST_STATIC_ASSERT(noexcept(boost::foreach_detail_::done(any(), any(), ty<fragile>())));
+BOOST_STATIC_ASSERT(!noexcept(boost::foreach_detail_::next(any(), ty<fragile>())));
+BOOST_STATIC_ASSERT(noexcept(boost::foreach_detail_::deref(any(), ty<fragile>())));
+
+// moving a vector cannot throw, but copying one can
+BOOST_STATIC_ASSERT(noexcept(boost::foreach_detail_::contain(std::vector<int>(), (boost::mpl::true_ *)0)));
+BOOST_STATIC_ASSERT(!noexcept(boost::foreach_detail_::contain(boost::declval<std::vector<int> const &>(), (boost::mpl::true_ *)0)));
+BOOST_STATIC_ASSERT(noexcept(boost::foreach_detail_::contain(boost::declval<std::vector<int> &>(), (boost::mpl::false_ *)0)));
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    int const data[] = {1, 2, 3, 4, 5};
+
+    // an exception from the iterator leaves the loop, and destroys the copy
+    // BOOST_FOREACH made of an rvalue collection
+    int sum = 0;
+    try
+    {
+        BOOST_FOREACH(int i, fragile(data, data + 5, data + 2))
+            sum += i;
+        BOOST_TEST(false);
+    }
+    catch(fragile_error)
+    {
+    }
+    BOOST_TEST_EQ(1 + 2 + 3, sum);
+    BOOST_TEST_EQ(0, live);
+
+    fragile const lvalue(data, data + 5, data + 3);
+    sum = 0;
+    try
+    {
+        BOOST_FOREACH(int i, lvalue)
+            sum += i;
+        BOOST_TEST(false);
+    }
+    catch(fragile_error)
+    {
+    }
+    BOOST_TEST_EQ(1 + 2 + 3 + 4, sum);
+
+    // and so does one from the loop body
+    std::vector<int> v(data, data + 5);
+    sum = 0;
+    try
+    {
+        BOOST_FOREACH(int i, std::vector<int>(v))
+        {
+            if(4 == i)
+                throw fragile_error();
+            sum += i;
+        }
+        BOOST_TEST(false);
+    }
+    catch(fragile_error)
+    {
+    }
+    BOOST_TEST_EQ(1 + 2 + 3, sum);
+
+    BOOST_FOREACH(int i, fragile(data, data + 5, 0))
+        sum += i;
+    BOOST_TEST_EQ(6 + 15, sum);
+    BOOST_TEST_EQ(1, live);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,246 @@
+//  parallel.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_NO_CXX11_LAMBDAS) || defined(BOOST_NO_CXX11_HDR_THREAD)                      \
+ || defined(BOOST_NO_CXX11_HDR_MUTEX) || defined(BOOST_NO_CXX11_HDR_CONDITION_VARIABLE)         \
+ || defined(BOOST_NO_CXX11_HDR_ATOMIC) || defined(BOOST_NO_CXX11_THREAD_LOCAL)                  \
+ || defined(BOOST_NO_CXX11_RVALUE_REFERENCES) || defined(BOOST_NO_EXCEPTIONS)                   \
+ || defined(BOOST_FOREACH_LITE)
+
+int main()
+{
+    return boost::report_errors();
+}
+
+#else
+
+#include <set>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <boost/array.hpp>
+#include <boost/foreach_parallel.hpp>
+
+std::size_t const size = 10000;
+
+std::vector<int> get_vector()
+{
+    std::vector<int> v(size);
+    for(std::size_t i = 0; i != size; ++i)
+        v[i] = static_cast<int>(i);
+    return v;
+}
+
+long long const expected_sum = static_cast<long long>(size) * (size - 1) / 2;
+
+///////////////////////////////////////////////////////////////////////////////
+// visit_each_once
+//   each element is visited exactly once, whatever the number of threads
+void visit_each_once(unsigned concurrency)
+{
+    boost::foreach::set_parallel_concurrency(concurrency);
+
+    std::vector<int> visits(size, 0);
+    BOOST_PARALLEL_FOREACH(int &v, visits)
+    {
+        ++v;
+    };
+    int wrong = 0;
+    BOOST_FOREACH(int v, visits)
+        wrong += (1 != v);
+    BOOST_TEST_EQ(0, wrong);
+
+    std::atomic<long long> sum(0);
+    BOOST_PARALLEL_FOREACH(int i, get_vector())
+    {
+        sum += i;
+    };
+    BOOST_TEST_EQ(expected_sum, sum.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// contend
+//   several threads running parallel loops at once, each on its own data
+void contend()
+{
+    boost::foreach::set_parallel_concurrency(4);
+
+    std::atomic<int> failures(0);
+    std::vector<std::thread> threads;
+    for(int t = 0; t != 4; ++t)
+    {
+        threads.push_back(std::thread([&failures, t] {
+            for(int rep = 0; rep != 20; ++rep)
+            {
+                std::vector<int> v(size, t);
+                std::atomic<long long> sum(0);
+                BOOST_PARALLEL_FOREACH(int &i, v)
+                {
+                    i += 1;
+                    sum += i;
+                };
+                if(static_cast<long long>(size) * (t + 1) != sum.load())
+                    ++failures;
+            }
+        }));
+    }
+    BOOST_FOREACH(std::thread &thread, threads)
+        thread.join();
+    BOOST_TEST_EQ(0, failures.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    // serially, and on more threads than there are cores
+    visit_each_once(1);
+    visit_each_once(2);
+    visit_each_once(8);
+    visit_each_once(0);
+
+    // a single thread runs the loop on the calling thread
+    boost::foreach::set_parallel_concurrency(1);
+    std::thread::id const self = std::this_thread::get_id();
+    std::vector<int> v = get_vector();
+    bool elsewhere = false;
+    BOOST_PARALLEL_FOREACH(int i, v)
+    {
+        (void)i;
+        elsewhere = elsewhere || self != std::this_thread::get_id();
+    };
+    BOOST_TEST(!elsewhere);
+
+    boost::foreach::set_parallel_concurrency(4);
+    BOOST_TEST_EQ(4u, boost::foreach::parallel_concurrency());
+
+    // const collections, arrays and lightweight proxies
+    std::vector<int> const &cv = v;
+    std::atomic<long long> sum(0);
+    BOOST_PARALLEL_FOREACH(int const &i, cv)
+    {
+        sum += i;
+    };
+    BOOST_TEST_EQ(expected_sum, sum.load());
+
+    int arr[100];
+    BOOST_PARALLEL_FOREACH(int &i, arr)
+    {
+        i = 3;
+    };
+    sum = 0;
+    BOOST_PARALLEL_FOREACH(int i, std::make_pair(arr + 0, arr + 100))
+    {
+        sum += i;
+    };
+    BOOST_TEST_EQ(300, sum.load());
+
+    boost::array<std::string, 64> strings;
+    BOOST_PARALLEL_FOREACH(std::string &s, strings)
+    {
+        s = "abc";
+    };
+    int wrong = 0;
+    BOOST_FOREACH(std::string const &s, strings)
+        wrong += ("abc" != s);
+    BOOST_TEST_EQ(0, wrong);
+
+    // null-terminated strings
+    std::atomic<int> chars(0);
+    BOOST_PARALLEL_FOREACH(char ch, static_cast<char const *>("hello"))
+    {
+        chars += ch;
+    };
+    BOOST_TEST_EQ('h' + 'e' + 'l' + 'l' + 'o', chars.load());
+
+    // return goes on to the next element
+    sum = 0;
+    BOOST_PARALLEL_FOREACH(int i, v)
+    {
+        if(0 != i % 2)
+            return;
+        sum += i;
+    };
+    BOOST_TEST_EQ(static_cast<long long>(size / 2) * (size / 2 - 1), sum.load());
+
+    // nested loops run serially on the thread that meets them
+    std::vector<std::vector<int> > grid(50, std::vector<int>(50, 1));
+    sum = 0;
+    BOOST_PARALLEL_FOREACH(std::vector<int> &row, grid)
+    {
+        BOOST_PARALLEL_FOREACH(int &cell, row)
+        {
+            ++cell;
+            sum += cell;
+        };
+    };
+    BOOST_TEST_EQ(5000, sum.load());
+
+    // exceptions propagate to the caller, and the pool carries on afterwards
+    std::string what;
+    try
+    {
+        BOOST_PARALLEL_FOREACH(int i, v)
+        {
+            if(5000 == i)
+                throw std::runtime_error("5000");
+        };
+    }
+    catch(std::runtime_error const &e)
+    {
+        what = e.what();
+    }
+    BOOST_TEST_EQ(std::string("5000"), what);
+
+    what.clear();
+    try
+    {
+        BOOST_PARALLEL_FOREACH(int i, v)
+        {
+            throw std::runtime_error(std::to_string(i % 2));
+        };
+    }
+    catch(std::runtime_error const &e)
+    {
+        what = e.what();
+    }
+    BOOST_TEST("0" == what || "1" == what);
+
+    sum = 0;
+    BOOST_PARALLEL_FOREACH(int i, v)
+    {
+        sum += i;
+    };
+    BOOST_TEST_EQ(expected_sum, sum.load());
+
+    // empty collections
+    std::vector<int> empty;
+    BOOST_PARALLEL_FOREACH(int i, empty)
+    {
+        (void)i;
+        BOOST_TEST(false);
+    };
+
+    contend();
+
+    return boost::report_errors();
+}
+
+#endif
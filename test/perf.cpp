@@ -0,0 +1,130 @@
+//  perf.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   17 October 2026 : Initial version.
+*/
+
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if !defined(__linux__)                                                                         \
+ || defined(BOOST_NO_CXX11_LAMBDAS) || defined(BOOST_NO_CXX11_HDR_MUTEX)                       \
+ || defined(BOOST_NO_CXX11_HDR_ATOMIC) || defined(BOOST_NO_CXX11_HDR_CHRONO)                    \
+ || defined(BOOST_NO_CXX11_HDR_THREAD) || defined(BOOST_NO_CXX11_THREAD_LOCAL)                  \
+ || defined(BOOST_NO_CXX11_RVALUE_REFERENCES) || defined(BOOST_NO_CXX11_SMART_PTR)              \
+ || defined(BOOST_NO_EXCEPTIONS)
+
+int main()
+{
+    return boost::report_errors();
+}
+
+#else
+
+#define BOOST_FOREACH_PERF_COUNTERS
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <sstream>
+#include <boost/foreach.hpp>
+#include <boost/foreach_profile.hpp>
+
+using boost::foreach::profile::site_profile;
+
+///////////////////////////////////////////////////////////////////////////////
+// find
+//   The profile of the loops at a line of this file.
+site_profile find(int line)
+{
+    std::vector<site_profile> const profiles = boost::foreach::profile::collect();
+    for(std::size_t i = 0; i != profiles.size(); ++i)
+    {
+        if(profiles[i].line == line && profiles[i].file == __FILE__)
+            return profiles[i];
+    }
+    site_profile none = {__FILE__, line, std::string(), 0, 0, 0,
+                         std::vector<unsigned long long>(), std::vector<unsigned long long>()};
+    return none;
+}
+
+int const sum_line = __LINE__ + 5;
+
+unsigned sum(std::vector<unsigned> const &v)
+{
+    unsigned result = 0;
+    BOOST_FOREACH(unsigned i, v)
+        result += i * i;
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    // the hardware events, the software events that stand in for them, or,
+    // where perf_event_open is not allowed, none
+    std::vector<std::string> const events = boost::foreach::perf::events();
+    bool const hardware = boost::foreach::perf::hardware();
+    BOOST_TEST(events.empty() || events.size() == (hardware ? 4u : 3u));
+    BOOST_TEST(events.empty() || events[0] == (hardware ? "instructions" : "task-clock"));
+
+    std::vector<unsigned> v(1 << 16, 3);
+    unsigned total = 0;
+    for(int k = 0; k != 4; ++k)
+        total += sum(v);
+    BOOST_TEST_EQ(4u * 9u * v.size(), total);
+
+    // a loop counts the events of its own thread, while it runs
+    site_profile p = find(sum_line);
+    BOOST_TEST_EQ(4u, p.entries);
+    BOOST_TEST_EQ(events.size(), p.events.size());
+    if(!p.events.empty())
+    {
+        // instructions, or nanoseconds of task-clock: a vectorized loop may
+        // take less than one of either per element, but no loop takes none
+        BOOST_TEST(p.events[0] > 0u);
+    }
+
+    // the events of a loop include those of the loops nested in it
+    int const outer_line = __LINE__ + 2;
+    int const inner_line = __LINE__ + 2;
+    BOOST_FOREACH(int i, std::vector<int>(4, 1))
+        BOOST_FOREACH(unsigned j, v)
+            total += i * j;
+    site_profile const outer = find(outer_line);
+    site_profile const inner = find(inner_line);
+    BOOST_TEST_EQ(1u, outer.entries);
+    BOOST_TEST_EQ(4u, inner.entries);
+    for(std::size_t e = 0; e != outer.events.size() && e != inner.events.size(); ++e)
+        BOOST_TEST(outer.events[e] >= inner.events[e]);
+
+    // the counts of threads that have exited are kept
+    unsigned long long const before = p.events.empty() ? 0 : p.events[0];
+    std::thread worker([&v] {
+        for(int k = 0; k != 4; ++k)
+            sum(v);
+    });
+    worker.join();
+    p = find(sum_line);
+    BOOST_TEST_EQ(8u, p.entries);
+    if(!p.events.empty())
+        BOOST_TEST(p.events[0] > before);
+
+    // the report gives the events under each site
+    std::ostringstream report;
+    boost::foreach::profile::dump(report);
+    if(!events.empty())
+        BOOST_TEST(std::string::npos != report.str().find(events[0] + ' '));
+
+    return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,157 @@
+//  prefetch.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <map>
+#include <set>
+#include <list>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <iterator>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/foreach.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// checked_iterator
+//   notices being dereferenced or moved outside of its range, so we can check
+//   that the iterator BOOST_FOREACH_PREFETCH runs ahead with stops at the end
+bool overrun = false;
+
+struct checked_iterator
+{
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef int value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef int const *pointer;
+    typedef int const &reference;
+
+    checked_iterator(int const *p = 0, int const *begin = 0, int const *end = 0)
+      : p(p), begin(begin), end(end) {}
+    reference operator*() const { overrun = overrun || p == end; return *p; }
+    checked_iterator &operator++() { overrun = overrun || p == end; ++p; return *this; }
+    checked_iterator operator++(int) { checked_iterator tmp(*this); ++*this; return tmp; }
+    checked_iterator &operator--() { overrun = overrun || p == begin; --p; return *this; }
+    checked_iterator operator--(int) { checked_iterator tmp(*this); --*this; return tmp; }
+    bool operator==(checked_iterator const &that) const { return p == that.p; }
+    bool operator!=(checked_iterator const &that) const { return p != that.p; }
+
+    int const *p;
+    int const *begin;
+    int const *end;
+};
+
+int const data[] = {1, 2, 3, 4, 5};
+
+std::pair<checked_iterator, checked_iterator> make_checked_range()
+{
+    return std::make_pair(
+        checked_iterator(data, data, data + 5)
+      , checked_iterator(data + 5, data, data + 5));
+}
+
+std::list<int> get_list()
+{
+    return std::list<int>(data, data + 5);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// digits
+//   the elements visited, forwards then backwards, as digits
+template<typename Range>
+std::string digits(Range const &rng, std::size_t distance)
+{
+    std::string s;
+    BOOST_FOREACH_PREFETCH(int i, rng, distance)
+        s += static_cast<char>('0' + i);
+    s += '|';
+    BOOST_REVERSE_FOREACH_PREFETCH(int i, rng, distance)
+        s += static_cast<char>('0' + i);
+    return s;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    std::list<int> l(data, data + 5);
+    std::set<int> s(data, data + 5);
+    std::vector<int> v(data, data + 5);
+
+    // whatever the distance, even more than the number of elements
+    for(std::size_t distance = 0; distance != 8; ++distance)
+    {
+        BOOST_TEST_EQ(std::string("12345|54321"), digits(l, distance));
+        BOOST_TEST_EQ(std::string("12345|54321"), digits(s, distance));
+        BOOST_TEST_EQ(std::string("12345|54321"), digits(v, distance));
+        BOOST_TEST_EQ(std::string("12345|54321"), digits(data, distance));
+        BOOST_TEST_EQ(std::string("12345|54321"), digits(make_checked_range(), distance));
+        BOOST_TEST_EQ(std::string("|"), digits(std::list<int>(), distance));
+    }
+    BOOST_TEST(!overrun);
+
+    // maps, by reference
+    std::map<int, std::string> m;
+    m[2] = "two";
+    m[1] = "one";
+    typedef std::map<int, std::string>::value_type pair_t;
+    std::string names;
+    BOOST_FOREACH_PREFETCH(pair_t &p, m, 4)
+    {
+        p.second += ",";
+        names += p.second;
+    }
+    BOOST_TEST_EQ(std::string("one,two,"), names);
+
+    // mutable references, and rvalues
+    BOOST_FOREACH_PREFETCH(int &i, l, 2)
+        i *= 2;
+    BOOST_TEST_EQ(10, l.back());
+
+    int sum = 0;
+    BOOST_FOREACH_PREFETCH(int i, get_list(), 2)
+        sum += i;
+    BOOST_TEST_EQ(15, sum);
+
+    // proxies have nothing to prefetch, and null-terminated strings
+    std::vector<bool> bits(3, true);
+    int set = 0;
+    BOOST_FOREACH_PREFETCH(bool b, bits, 2)
+        set += b;
+    BOOST_TEST_EQ(3, set);
+
+    std::string str;
+    BOOST_REVERSE_FOREACH_PREFETCH(char ch, static_cast<char const *>("hello"), 2)
+        str += ch;
+    BOOST_TEST_EQ(std::string("olleh"), str);
+
+    // break and continue
+    str.clear();
+    BOOST_FOREACH_PREFETCH(int i, v, 2)
+    {
+        if(2 == i)
+            continue;
+        if(4 == i)
+            break;
+        str += static_cast<char>('0' + i);
+    }
+    BOOST_TEST_EQ(std::string("13"), str);
+
+    // a predeclared variable keeps the last element
+    int last = 0;
+    BOOST_REVERSE_FOREACH_PREFETCH(last, s, 3)
+    {
+    }
+    BOOST_TEST_EQ(1, last);
+
+    return boost::report_errors();
+}
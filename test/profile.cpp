@@ -0,0 +1,174 @@
+//  profile.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_NO_CXX11_LAMBDAS) || defined(BOOST_NO_CXX11_HDR_MUTEX)                       \
+ || defined(BOOST_NO_CXX11_HDR_ATOMIC) || defined(BOOST_NO_CXX11_HDR_CHRONO)                    \
+ || defined(BOOST_NO_CXX11_HDR_THREAD) || defined(BOOST_NO_CXX11_THREAD_LOCAL)                  \
+ || defined(BOOST_NO_CXX11_RVALUE_REFERENCES) || defined(BOOST_NO_CXX11_SMART_PTR)              \
+ || defined(BOOST_NO_EXCEPTIONS)
+
+int main()
+{
+    return boost::report_errors();
+}
+
+#else
+
+#define BOOST_FOREACH_PROFILE
+
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sstream>
+#include <boost/foreach.hpp>
+#include <boost/foreach_profile.hpp>
+
+using boost::foreach::profile::site_profile;
+
+///////////////////////////////////////////////////////////////////////////////
+// find
+//   The profile of the loops at a line of this file.
+site_profile find(int line, std::string const &type = std::string())
+{
+    std::vector<site_profile> const profiles = boost::foreach::profile::collect();
+    for(std::size_t i = 0; i != profiles.size(); ++i)
+    {
+        if(profiles[i].line == line && profiles[i].file == __FILE__
+           && std::string::npos != profiles[i].type.find(type))
+            return profiles[i];
+    }
+    site_profile none = {__FILE__, line, type, 0, 0, 0,
+                         std::vector<unsigned long long>(), std::vector<unsigned long long>()};
+    return none;
+}
+
+int const sum_line = __LINE__ + 6;
+
+template<typename Collection>
+int sum(Collection const &col)
+{
+    int result = 0;
+    BOOST_FOREACH(int i, col)
+        result += i;
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    std::vector<int> v;
+    for(int i = 1; i <= 5; ++i)
+        v.push_back(i);
+
+    // loops of 0, 1, 5 and 5 iterations at one site
+    std::vector<int> const empty;
+    std::vector<int> const one(1, 7);
+    int total = 0;
+    total += sum(empty);
+    total += sum(one);
+    total += sum(v);
+    total += sum(v);
+    BOOST_TEST_EQ(7 + 15 + 15, total);
+
+    site_profile p = find(sum_line, "vector");
+    BOOST_TEST_EQ(4u, p.entries);
+    BOOST_TEST_EQ(11u, p.iterations);
+    BOOST_TEST_EQ(4u, p.histogram.size());
+    BOOST_TEST_EQ(1u, p.histogram[0]); // 0
+    BOOST_TEST_EQ(1u, p.histogram[1]); // 1
+    BOOST_TEST_EQ(0u, p.histogram[2]); // 2-3
+    BOOST_TEST_EQ(2u, p.histogram[3]); // 4-7
+
+    // each instantiation is a site of its own
+    std::list<int> const l(v.begin(), v.end());
+    BOOST_TEST_EQ(15, sum(l));
+    BOOST_TEST_EQ(1u, find(sum_line, "list").entries);
+    BOOST_TEST_EQ(4u, find(sum_line, "vector").entries);
+
+    // break, and an exception, end the loop where they leave it
+    int const break_line = __LINE__ + 1;
+    BOOST_FOREACH(int i, v)
+    {
+        if(3 == i)
+            break;
+    }
+    p = find(break_line);
+    BOOST_TEST_EQ(1u, p.entries);
+    BOOST_TEST_EQ(3u, p.iterations);
+
+    int const throw_line = __LINE__ + 3;
+    try
+    {
+        BOOST_FOREACH(int i, std::vector<int>(v))
+        {
+            if(2 == i)
+                throw i;
+        }
+    }
+    catch(int)
+    {
+    }
+    p = find(throw_line);
+    BOOST_TEST_EQ(1u, p.entries);
+    BOOST_TEST_EQ(2u, p.iterations);
+
+    // BOOST_REVERSE_FOREACH, and continue
+    int const reverse_line = __LINE__ + 1;
+    BOOST_REVERSE_FOREACH(int i, v)
+    {
+        if(i % 2)
+            continue;
+        total += i;
+    }
+    p = find(reverse_line);
+    BOOST_TEST_EQ(1u, p.entries);
+    BOOST_TEST_EQ(5u, p.iterations);
+
+    // nested loops count each of their entries
+    int const outer_line = __LINE__ + 2;
+    int const inner_line = __LINE__ + 2;
+    BOOST_FOREACH(int i, v)
+        BOOST_FOREACH(int j, one)
+            total += i * j;
+    BOOST_TEST_EQ(1u, find(outer_line).entries);
+    BOOST_TEST_EQ(5u, find(inner_line).entries);
+    BOOST_TEST_EQ(5u, find(inner_line).iterations);
+
+    // the counts of threads that have exited are kept
+    std::thread worker([&v] {
+        for(int k = 0; k != 10; ++k)
+            sum(v);
+    });
+    worker.join();
+    p = find(sum_line, "vector");
+    BOOST_TEST_EQ(14u, p.entries);
+    BOOST_TEST_EQ(61u, p.iterations);
+    BOOST_TEST_EQ(12u, p.histogram[3]);
+
+    // the report names each site
+    std::ostringstream report;
+    boost::foreach::profile::dump(report);
+    std::ostringstream site;
+    site << __FILE__ << ':' << break_line;
+    BOOST_TEST(std::string::npos != report.str().find(site.str()));
+    BOOST_TEST(std::string::npos != report.str().find("4-7:12"));
+
+    return boost::report_errors();
+}
+
+#endif
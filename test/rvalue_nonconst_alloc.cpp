@@ -0,0 +1,92 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+  Revision history:
+  16 October 2026 : Initial version.
+*/
+
+#include <new>
+#include <cstdlib>
+#include <vector>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/foreach.hpp>
+
+#ifdef BOOST_FOREACH_NO_RVALUE_DETECTION
+# error Expected failure : rvalues disallowed
+#else
+
+///////////////////////////////////////////////////////////////////////////////
+// count every dynamic allocation
+int allocations = 0;
+
+#ifdef BOOST_NO_CXX11_NOEXCEPT
+void *operator new(std::size_t size) throw(std::bad_alloc)
+#else
+void *operator new(std::size_t size)
+#endif
+{
+    ++allocations;
+    if(void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) BOOST_NOEXCEPT_OR_NOTHROW
+{
+    std::free(p);
+}
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void *p, std::size_t) BOOST_NOEXCEPT
+{
+    std::free(p);
+}
+#endif
+
+std::vector<int> get_vector()
+{
+    return std::vector<int>(4, 4);
+}
+
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+// the collection is moved into the loop
+int const expected_copies = 0;
+#elif defined(BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION)
+// detecting the rvalue at run-time makes one copy, storing it makes another
+int const expected_copies = 2;
+#else
+// without move semantics the collection is copied once, but no more
+int const expected_copies = 1;
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    int counter = 0;
+
+    // one allocation for the vector returned by get_vector()
+    allocations = 0;
+    BOOST_FOREACH(int i, get_vector())
+    {
+        counter += i;
+    }
+    BOOST_TEST(16 == counter);
+    BOOST_TEST_EQ(1 + expected_copies, allocations);
+
+    allocations = 0;
+    BOOST_REVERSE_FOREACH(int i, get_vector())
+    {
+        counter -= i;
+    }
+    BOOST_TEST(0 == counter);
+    BOOST_TEST_EQ(1 + expected_copies, allocations);
+
+    return boost::report_errors();
+}
+
+#endif
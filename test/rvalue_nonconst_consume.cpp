@@ -0,0 +1,167 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+  Revision history:
+  17 October 2026 : Initial version.
+*/
+
+#include <new>
+#include <set>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/foreach.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#ifdef BOOST_FOREACH_NO_RVALUE_DETECTION
+# error Expected failure : rvalues disallowed
+#elif defined(BOOST_NO_CXX11_RVALUE_REFERENCES) || defined(BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION)
+
+// without move semantics, or where rvalues are detected at run time,
+// BOOST_FOREACH_CONSUME is BOOST_FOREACH
+int main()
+{
+    return boost::report_errors();
+}
+
+#else
+
+///////////////////////////////////////////////////////////////////////////////
+// count every dynamic allocation
+int allocations = 0;
+
+// GCC sees the free() in these inlined into code that allocated with the
+// operator new it replaces, and takes them for a mismatch
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void *operator new(std::size_t size)
+{
+    ++allocations;
+    if(void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) BOOST_NOEXCEPT_OR_NOTHROW
+{
+    std::free(p);
+}
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void *p, std::size_t) BOOST_NOEXCEPT
+{
+    std::free(p);
+}
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+# pragma GCC diagnostic pop
+#endif
+
+// too long to be stored in the string itself
+std::string const name(32, 'n');
+
+std::vector<std::string> get_names()
+{
+    return std::vector<std::string>(4, name);
+}
+
+std::vector<std::vector<int> > get_rows()
+{
+    return std::vector<std::vector<int> >(4, std::vector<int>(8, 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    std::size_t length = 0;
+
+    // BOOST_FOREACH copies each string out of the vector; one allocation for
+    // the vector and four for its strings, and four for the copies
+    std::vector<std::string> names = get_names();
+    allocations = 0;
+    BOOST_FOREACH(std::string s, get_names())
+        length += s.size();
+    BOOST_TEST_EQ(5 + 4, allocations);
+
+    // BOOST_FOREACH_CONSUME moves them
+    allocations = 0;
+    BOOST_FOREACH_CONSUME(std::string s, get_names())
+        length += s.size();
+    BOOST_TEST_EQ(5, allocations);
+
+    // one allocation for each row, one for the row they are copied from, and
+    // one for the vector of them
+    allocations = 0;
+    BOOST_FOREACH_CONSUME(std::vector<int> row, get_rows())
+        length += row.size();
+    BOOST_TEST_EQ(6, allocations);
+
+    // the loop variable can be an rvalue reference, to take each element
+    // without a move
+    std::vector<std::string> taken;
+    taken.reserve(8);
+    allocations = 0;
+    BOOST_FOREACH_CONSUME(std::string &&s, get_names())
+        taken.push_back(std::move(s));
+    BOOST_TEST_EQ(5, allocations);
+    BOOST_TEST(std::vector<std::string>(4, name) == taken);
+
+    // break and continue
+    int visited = 0;
+    BOOST_FOREACH_CONSUME(std::string s, get_names())
+    {
+        if(++visited == 2)
+            continue;
+        if(visited == 3)
+            break;
+        length += s.size();
+    }
+    BOOST_TEST_EQ(3, visited);
+
+    // an lvalue is not consumed, and neither is a view of one
+    allocations = 0;
+    BOOST_FOREACH_CONSUME(std::string s, names)
+        length += s.size();
+    BOOST_FOREACH_CONSUME(std::string s, boost::make_iterator_range(names))
+        length += s.size();
+    BOOST_TEST_EQ(8, allocations);
+    BOOST_TEST(std::vector<std::string>(4, name) == names);
+
+    // nor is a const rvalue, which is copied as BOOST_FOREACH copies it, nor
+    // the const elements of a set
+    std::vector<std::string> const cnames = names;
+    allocations = 0;
+    BOOST_FOREACH(std::string s, static_cast<std::vector<std::string> const &&>(std::vector<std::string>(cnames)))
+        length += s.size();
+    int const copied = allocations;
+    allocations = 0;
+    BOOST_FOREACH_CONSUME(std::string s, static_cast<std::vector<std::string> const &&>(std::vector<std::string>(cnames)))
+        length += s.size();
+    BOOST_TEST_EQ(copied, allocations);
+    std::set<std::string> distinct;
+    BOOST_FOREACH_CONSUME(std::string s, std::set<std::string>(names.begin(), names.end()))
+        distinct.insert(s);
+    BOOST_TEST_EQ(1u, distinct.size());
+
+    // std::move consumes a named vector, without any allocation
+    allocations = 0;
+    BOOST_FOREACH_CONSUME(std::string &&s, std::move(names))
+        taken.push_back(std::move(s));
+    BOOST_TEST_EQ(0, allocations);
+    BOOST_TEST_EQ(8u, taken.size());
+
+    BOOST_TEST(length > 0);
+    return boost::report_errors();
+}
+
+#endif
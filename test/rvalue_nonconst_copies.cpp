@@ -0,0 +1,135 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+  Revision history:
+  17 October 2026 : Initial version.
+*/
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/foreach.hpp>
+
+#ifdef BOOST_FOREACH_NO_RVALUE_DETECTION
+# error Expected failure : rvalues disallowed
+#else
+
+///////////////////////////////////////////////////////////////////////////////
+// copy_only
+//   a collection that can be copied but not moved, like boost::array or a
+//   container written for C++03, that counts its copies
+int copies = 0;
+
+struct copy_only
+{
+    typedef int *iterator;
+    typedef int const *const_iterator;
+
+    copy_only() { for(int i = 0; i < 4; ++i) elems[i] = i + 1; }
+    copy_only(copy_only const &that) { ++copies; for(int i = 0; i < 4; ++i) elems[i] = that.elems[i]; }
+    iterator begin() { return elems; }
+    iterator end() { return elems + 4; }
+    const_iterator begin() const { return elems; }
+    const_iterator end() const { return elems + 4; }
+
+    int elems[4];
+};
+
+copy_only get_copy_only()
+{
+    return copy_only();
+}
+
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+///////////////////////////////////////////////////////////////////////////////
+// movable
+//   a collection that counts its copies and its moves
+int moves = 0;
+
+struct movable : copy_only
+{
+    movable() {}
+    movable(movable const &that) : copy_only(that) {}
+    movable(movable &&that) : copy_only() { ++moves; for(int i = 0; i < 4; ++i) elems[i] = that.elems[i]; }
+};
+
+movable get_movable()
+{
+    return movable();
+}
+#endif
+
+#if defined(BOOST_FOREACH_RUN_TIME_CONST_RVALUE_DETECTION)
+// detecting the rvalue at run-time makes one copy, storing it makes another
+int const expected_copies = 2;
+#else
+// the collection is copied into the loop once, but no more
+int const expected_copies = 1;
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    int sum = 0;
+
+    // the copy-only rvalue is copied into the loop once, however the loop is
+    // lowered
+    copies = 0;
+    BOOST_FOREACH(int i, get_copy_only())
+        sum += i;
+    BOOST_TEST_EQ(10, sum);
+    BOOST_TEST_EQ(expected_copies, copies);
+
+    copies = 0;
+    BOOST_REVERSE_FOREACH(int i, get_copy_only())
+        sum -= i;
+    BOOST_TEST_EQ(0, sum);
+    BOOST_TEST_EQ(expected_copies, copies);
+
+    // and a break or a continue makes no difference
+    copies = 0;
+    BOOST_FOREACH(int i, get_copy_only())
+    {
+        if(1 == i)
+            continue;
+        if(3 == i)
+            break;
+        sum += i;
+    }
+    BOOST_TEST_EQ(2, sum);
+    BOOST_TEST_EQ(expected_copies, copies);
+
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    // a movable rvalue is moved into the loop once, and never copied
+    copies = moves = 0;
+    BOOST_FOREACH(int i, get_movable())
+        sum += i;
+    BOOST_TEST_EQ(12, sum);
+    BOOST_TEST_EQ(0, copies);
+    BOOST_TEST_EQ(1, moves);
+
+    copies = moves = 0;
+    BOOST_REVERSE_FOREACH(int i, get_movable())
+        sum -= i;
+    BOOST_TEST_EQ(2, sum);
+    BOOST_TEST_EQ(0, copies);
+    BOOST_TEST_EQ(1, moves);
+#endif
+
+    // an lvalue is not copied at all
+    copy_only const col;
+    copies = 0;
+    BOOST_FOREACH(int i, col)
+        sum += i;
+    BOOST_REVERSE_FOREACH(int i, col)
+        sum -= i;
+    BOOST_TEST_EQ(2, sum);
+    BOOST_TEST_EQ(0, copies);
+
+    return boost::report_errors();
+}
+
+#endif
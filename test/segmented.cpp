@@ -0,0 +1,198 @@
+//  segmented.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <deque>
+#include <vector>
+#include <cstddef>
+#include <iterator>
+#include <boost/mpl/assert.hpp>
+#include <boost/circular_buffer.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/foreach.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// chunked
+//   ten ints in blocks of four, whose iterator counts how many times it has
+//   been incremented. BOOST_FOREACH iterates over each block with a pointer,
+//   so it never increments it.
+int increments = 0;
+int segments = 0;
+
+std::size_t const block_size = 4;
+
+template<typename T>
+struct chunked_iterator
+{
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef typename boost::remove_const<T>::type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T *pointer;
+    typedef T &reference;
+
+    chunked_iterator(T *base = 0, std::size_t i = 0) : base(base), i(i) {}
+    reference operator*() const { return base[i]; }
+    reference operator[](difference_type n) const { return base[i + n]; }
+    chunked_iterator &operator++() { ++increments; ++i; return *this; }
+    chunked_iterator operator++(int) { chunked_iterator tmp(*this); ++*this; return tmp; }
+    chunked_iterator &operator--() { ++increments; --i; return *this; }
+    chunked_iterator operator--(int) { chunked_iterator tmp(*this); --*this; return tmp; }
+    chunked_iterator &operator+=(difference_type n) { i += n; return *this; }
+    chunked_iterator &operator-=(difference_type n) { i -= n; return *this; }
+    chunked_iterator operator+(difference_type n) const { return chunked_iterator(base, i + n); }
+    chunked_iterator operator-(difference_type n) const { return chunked_iterator(base, i - n); }
+    difference_type operator-(chunked_iterator const &that) const { return difference_type(i - that.i); }
+    bool operator==(chunked_iterator const &that) const { return i == that.i; }
+    bool operator!=(chunked_iterator const &that) const { return i != that.i; }
+    bool operator<(chunked_iterator const &that) const { return i < that.i; }
+
+    T *base;
+    std::size_t i;
+};
+
+struct chunked
+{
+    typedef chunked_iterator<int> iterator;
+    typedef chunked_iterator<int const> const_iterator;
+
+    chunked() { for(int i = 0; i < 10; ++i) elems[i] = i + 1; }
+    iterator begin() { return iterator(elems, 0); }
+    iterator end() { return iterator(elems, 10); }
+    const_iterator begin() const { return const_iterator(elems, 0); }
+    const_iterator end() const { return const_iterator(elems, 10); }
+
+    int elems[10];
+};
+
+namespace boost { namespace foreach
+{
+    template<typename T>
+    struct segmented_iterator<chunked_iterator<T> >
+      : boost::mpl::true_
+    {
+        static chunk<T> segment(chunked_iterator<T> const &cur, chunked_iterator<T> const &end)
+        {
+            ++::segments;
+            std::size_t const last = (cur.i / block_size + 1) * block_size;
+            return chunk<T>(cur.base + cur.i, (last < end.i ? last : end.i) - cur.i);
+        }
+    };
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+// a chunked collection, returned by value
+chunked get_chunked()
+{
+    return chunked();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    BOOST_MPL_ASSERT((boost::foreach::segmented_iterator<chunked::iterator>));
+    BOOST_MPL_ASSERT_NOT((boost::foreach::segmented_iterator<std::vector<int>::iterator>));
+    BOOST_MPL_ASSERT_NOT((boost::foreach::segmented_iterator<int *>));
+
+    // the collections of other libraries are only segmented with
+    // BOOST_FOREACH_LIBRARY_SEGMENTS; see segmented_libstdcxx.cpp and
+    // segmented_circular_buffer.cpp
+    BOOST_MPL_ASSERT_NOT((boost::foreach::segmented_iterator<std::deque<int>::iterator>));
+    BOOST_MPL_ASSERT_NOT((boost::foreach::segmented_iterator<boost::circular_buffer<int>::iterator>));
+
+    // every block is walked with a pointer
+    chunked c;
+    int sum = 0;
+    BOOST_FOREACH(int i, c)
+        sum += i;
+    BOOST_TEST_EQ(55, sum);
+    BOOST_TEST_EQ(0, increments);
+    BOOST_TEST_EQ(3, segments);
+
+    // by reference, into the collection
+    BOOST_FOREACH(int &i, c)
+        i *= 10;
+    BOOST_TEST_EQ(10, c.elems[0]);
+    BOOST_TEST_EQ(100, c.elems[9]);
+
+    // const and rvalue collections
+    chunked const &cc = c;
+    sum = 0;
+    BOOST_FOREACH(int const &i, cc)
+        sum += i;
+    BOOST_TEST_EQ(550, sum);
+
+    sum = 0;
+    BOOST_FOREACH(int i, get_chunked())
+        sum += i;
+    BOOST_TEST_EQ(55, sum);
+
+    // break and continue, in the first block, at the end of a block and in
+    // the last block
+    segments = 0;
+    sum = 0;
+    BOOST_FOREACH(int i, c)
+    {
+        if(20 == i || 40 == i)
+            continue;
+        if(90 == i)
+            break;
+        sum += i;
+    }
+    BOOST_TEST_EQ(10 + 30 + 50 + 60 + 70 + 80, sum);
+    BOOST_TEST_EQ(3, segments);
+
+    segments = 0;
+    sum = 0;
+    BOOST_FOREACH(int i, c)
+    {
+        sum += i;
+        if(40 == i)
+            break;
+    }
+    BOOST_TEST_EQ(100, sum);
+    BOOST_TEST_EQ(1, segments);
+
+    // predeclared loop variables keep the last element
+    int last = 0;
+    BOOST_FOREACH(last, c)
+    {
+    }
+    BOOST_TEST_EQ(100, last);
+
+    // a range that starts and ends inside blocks
+    sum = 0;
+    BOOST_FOREACH(int i, boost::make_iterator_range(c.begin() + 3, c.end() - 1))
+        sum += i;
+    BOOST_TEST_EQ(40 + 50 + 60 + 70 + 80 + 90, sum);
+
+    // empty collections and ranges
+    BOOST_FOREACH(int i, boost::make_iterator_range(c.begin() + 5, c.begin() + 5))
+    {
+        (void)i;
+        BOOST_TEST(false);
+    }
+
+    // reverse iteration is an element at a time
+    increments = 0;
+    std::vector<int> seen;
+    BOOST_REVERSE_FOREACH(int i, c)
+        seen.push_back(i);
+    BOOST_TEST_EQ(10u, seen.size());
+    BOOST_TEST_EQ(100, seen.front());
+    BOOST_TEST_EQ(10, seen.back());
+    BOOST_TEST_NE(0, increments);
+
+    return boost::report_errors();
+}
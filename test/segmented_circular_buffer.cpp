@@ -0,0 +1,85 @@
+//  segmented_circular_buffer.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   17 October 2026 : Initial version.
+*/
+
+// BOOST_FOREACH iterates over boost::circular_buffer a block at a time with
+// the Boost versions BOOST_FOREACH_LIBRARY_SEGMENTS knows the iterators of.
+// Elsewhere it is iterated an element at a time, and must give the same
+// results.
+#define BOOST_FOREACH_LIBRARY_SEGMENTS
+
+#include <vector>
+#include <cstddef>
+#include <boost/mpl/assert.hpp>
+#include <boost/circular_buffer.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/foreach.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+#ifdef BOOST_FOREACH_CIRCULAR_BUFFER_SEGMENTS
+    BOOST_MPL_ASSERT((boost::foreach::segmented_iterator<boost::circular_buffer<int>::iterator>));
+    BOOST_MPL_ASSERT((boost::foreach::segmented_iterator<boost::circular_buffer<int>::const_iterator>));
+#endif
+
+    // linear and wrapped around
+    boost::circular_buffer<int> cb(8);
+    for(int i = 0; i < 5; ++i)
+        cb.push_back(i);
+    std::vector<int> elems;
+    BOOST_FOREACH(int i, cb)
+        elems.push_back(i);
+    BOOST_TEST_EQ(5u, elems.size());
+    BOOST_TEST_EQ(4, elems.back());
+
+    for(int i = 5; i < 13; ++i)
+        cb.push_back(i);
+    BOOST_TEST(!cb.is_linearized());
+    elems.clear();
+    BOOST_FOREACH(int &i, cb)
+    {
+        elems.push_back(i);
+        i = -i;
+    }
+    BOOST_TEST_EQ(8u, elems.size());
+    for(std::size_t i = 0; i != elems.size(); ++i)
+        BOOST_TEST_EQ(static_cast<int>(i) + 5, elems[i]);
+    BOOST_TEST_EQ(-5, cb.front());
+    BOOST_TEST_EQ(-12, cb.back());
+
+    // break and continue over a range that starts and ends inside the blocks
+    boost::circular_buffer<int> const &ccb = cb;
+    elems.clear();
+    BOOST_FOREACH(int i, boost::make_iterator_range(ccb.begin() + 1, ccb.end() - 1))
+    {
+        if(-7 == i)
+            continue;
+        elems.push_back(i);
+        if(-10 == i)
+            break;
+    }
+    BOOST_TEST_EQ(4u, elems.size());
+    BOOST_TEST_EQ(-6, elems.front());
+    BOOST_TEST_EQ(-10, elems.back());
+
+    boost::circular_buffer<int> empty(4);
+    BOOST_FOREACH(int i, empty)
+    {
+        (void)i;
+        BOOST_TEST(false);
+    }
+
+    return boost::report_errors();
+}
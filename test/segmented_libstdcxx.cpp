@@ -0,0 +1,125 @@
+//  segmented_libstdcxx.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   17 October 2026 : Initial version.
+*/
+
+// BOOST_FOREACH iterates over std::deque a block at a time, and over
+// std::vector<bool> a word at a time, with the libstdc++ versions
+// BOOST_FOREACH_LIBRARY_SEGMENTS knows the iterators of. Elsewhere they are
+// iterated an element at a time, and must give the same results.
+#define BOOST_FOREACH_LIBRARY_SEGMENTS
+
+#include <deque>
+#include <vector>
+#include <cstddef>
+#include <boost/mpl/assert.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/foreach.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+#ifdef BOOST_FOREACH_LIBSTDCXX_SEGMENTS
+    BOOST_MPL_ASSERT((boost::foreach::segmented_iterator<std::deque<int>::iterator>));
+    BOOST_MPL_ASSERT((boost::foreach::segmented_iterator<std::deque<int>::const_iterator>));
+    BOOST_MPL_ASSERT((boost::foreach::segmented_iterator<std::vector<bool>::iterator>));
+    BOOST_MPL_ASSERT((boost::foreach::segmented_iterator<std::vector<bool>::const_iterator>));
+#endif
+    BOOST_MPL_ASSERT_NOT((boost::foreach::segmented_iterator<std::vector<int>::iterator>));
+
+    // std::deque, over several blocks, with break and continue
+    std::deque<int> d;
+    for(int i = 0; i < 1000; ++i)
+        d.push_front(i);
+    d.pop_back();
+    long long dsum = 0;
+    BOOST_FOREACH(int i, d)
+        dsum += i;
+    BOOST_TEST_EQ(999LL * 1000 / 2, dsum);
+
+    BOOST_FOREACH(int &i, d)
+        ++i;
+    dsum = 0;
+    BOOST_FOREACH(int i, d)
+    {
+        if(i % 2)
+            continue;
+        if(i < 100)
+            break;
+        dsum += i;
+    }
+    BOOST_TEST_EQ(2LL * (50 + 500) * 451 / 2, dsum);
+
+    std::deque<int> const &cd = d;
+    dsum = 0;
+    BOOST_FOREACH(int i, boost::make_iterator_range(cd.begin() + 100, cd.end() - 100))
+        dsum += i;
+    BOOST_TEST_EQ(1LL * (102 + 900) * 799 / 2, dsum);
+
+    std::deque<int> none;
+    BOOST_FOREACH(int i, none)
+    {
+        (void)i;
+        BOOST_TEST(false);
+    }
+
+    // std::vector<bool>: every third bit of 200, and the last one, which is
+    // in the tail of a word
+    std::size_t const nbits = 200;
+    std::vector<bool> v(nbits);
+    for(std::size_t i = 0; i != nbits; ++i)
+        v[i] = 0 == i % 3 || nbits - 1 == i;
+    std::size_t count = 0;
+    BOOST_FOREACH(bool b, v)
+        count += b;
+    BOOST_TEST_EQ(68u, count);
+
+    // writes through the proxy reference
+    BOOST_FOREACH(std::vector<bool>::reference b, v)
+        b = !b;
+    std::size_t i = 0;
+    BOOST_FOREACH(bool b, v)
+    {
+        BOOST_TEST_EQ(!(0 == i % 3 || nbits - 1 == i), b);
+        ++i;
+    }
+    BOOST_TEST_EQ(nbits, i);
+
+    // break and continue, and a range that starts and ends inside words
+    std::vector<bool> const &cv = v;
+    i = 0;
+    count = 0;
+    BOOST_FOREACH(bool b, cv)
+    {
+        if(++i == 70)
+            continue;
+        if(i == 150)
+            break;
+        count += b;
+    }
+    BOOST_TEST_EQ(149u - 50, count);
+
+    count = 0;
+    BOOST_FOREACH(bool b, boost::make_iterator_range(cv.begin() + 5, cv.end() - 70))
+        count += !b;
+    BOOST_TEST_EQ(42u, count);
+
+    std::vector<bool> no_bits;
+    BOOST_FOREACH(bool b, no_bits)
+    {
+        (void)b;
+        BOOST_TEST(false);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,289 @@
+//  sentinel.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <boost/config.hpp>
+#include <boost/foreach.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_NO_CXX11_DECLTYPE) || defined(BOOST_NO_SFINAE_EXPR)
+
+// Without decltype, collections cannot have sentinels.
+int main()
+{
+    return boost::report_errors();
+}
+
+#else
+
+#include <boost/mpl/assert.hpp>
+#include <boost/type_traits/remove_const.hpp>
+
+#if defined(__cpp_lib_ranges)
+# include <ranges>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// delimited
+//   a buffer of ints that ends at the first 0, whose end() is a sentinel that
+//   compares equal to an iterator at a 0. Finding an end iterator would take a
+//   scan of the buffer, so it has none.
+int end_calls = 0;
+
+struct terminator
+{
+};
+
+template<typename T>
+struct delimited_iterator
+{
+    typedef std::forward_iterator_tag iterator_category;
+    typedef typename boost::remove_const<T>::type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T *pointer;
+    typedef T &reference;
+
+    explicit delimited_iterator(T *p = 0) : p(p) {}
+    reference operator*() const { return *p; }
+    delimited_iterator &operator++() { ++p; return *this; }
+    delimited_iterator operator++(int) { delimited_iterator tmp(*this); ++p; return tmp; }
+    bool operator==(delimited_iterator const &that) const { return p == that.p; }
+    bool operator!=(delimited_iterator const &that) const { return p != that.p; }
+    bool operator==(terminator) const { return 0 == *p; }
+
+    T *p;
+};
+
+struct delimited
+{
+    typedef delimited_iterator<int> iterator;
+    typedef delimited_iterator<int const> const_iterator;
+
+    explicit delimited(int *p) : p(p) {}
+    iterator begin() { return iterator(p); }
+    const_iterator begin() const { return const_iterator(p); }
+    terminator end() const { ++end_calls; return terminator(); }
+
+    int *p;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// counted
+//   a length-prefixed buffer: the iterator counts down the elements it has
+//   left, and the sentinel is where the count reaches 0.
+struct last_element
+{
+};
+
+struct counted_iterator
+{
+    typedef std::forward_iterator_tag iterator_category;
+    typedef char value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef char const *pointer;
+    typedef char const &reference;
+
+    counted_iterator() : p(0), left(0) {}
+    counted_iterator(char const *p, std::size_t left) : p(p), left(left) {}
+    reference operator*() const { return *p; }
+    counted_iterator &operator++() { ++p; --left; return *this; }
+    counted_iterator operator++(int) { counted_iterator tmp(*this); ++*this; return tmp; }
+    bool operator==(counted_iterator const &that) const { return p == that.p; }
+    bool operator!=(counted_iterator const &that) const { return p != that.p; }
+    bool operator==(last_element) const { return 0 == left; }
+
+    char const *p;
+    std::size_t left;
+};
+
+struct counted
+{
+    typedef counted_iterator iterator;
+    typedef counted_iterator const_iterator;
+
+    explicit counted(char const *buf) : buf(buf) {}
+    counted_iterator begin() const { return counted_iterator(buf + 1, static_cast<unsigned char>(*buf)); }
+    last_element end() const { return last_element(); }
+
+    char const *buf;
+};
+
+namespace boost { namespace foreach
+{
+    // Copying a counted copies a pointer
+    template<>
+    struct is_lightweight_proxy<counted>
+      : boost::mpl::true_
+    {
+    };
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+// tail
+//   a slice of an array whose end() returns an iterator of another type than
+//   begin(), that converts to begin()'s. Its end is an iterator, not a
+//   sentinel, so it can also be iterated in reverse.
+struct tail_pointer
+{
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef int value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef int *pointer;
+    typedef int &reference;
+
+    explicit tail_pointer(int *p) : p(p) {}
+    operator int *() const { return p; }
+
+    int *p;
+};
+
+struct tail
+{
+    typedef int *iterator;
+    typedef int *const_iterator;
+
+    tail(int *first, int *last) : first(first), last(last) {}
+    int *begin() const { return first; }
+    tail_pointer end() const { return tail_pointer(last); }
+
+    int *first;
+    int *last;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// a delimited collection, returned by value
+int numbers[] = {1, 2, 3, 4, 5, 0, 6, 7};
+
+delimited get_delimited()
+{
+    return delimited(numbers);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    BOOST_MPL_ASSERT((boost::foreach::has_sentinel<delimited>));
+    BOOST_MPL_ASSERT((boost::foreach::has_sentinel<counted>));
+    BOOST_MPL_ASSERT_NOT((boost::foreach::has_sentinel<std::vector<int> >));
+    BOOST_MPL_ASSERT_NOT((boost::foreach::has_sentinel<std::string>));
+    BOOST_MPL_ASSERT_NOT((boost::foreach::has_sentinel<int[4]>));
+    BOOST_MPL_ASSERT_NOT((boost::foreach::has_sentinel<tail>));
+
+    // the loop stops at the sentinel, and asks for it once
+    delimited d(numbers);
+    std::vector<int> seen;
+    BOOST_FOREACH(int i, d)
+        seen.push_back(i);
+    BOOST_TEST_EQ(5u, seen.size());
+    BOOST_TEST_EQ(5, seen.back());
+    BOOST_TEST_EQ(1, end_calls);
+
+    // by reference, into the buffer
+    BOOST_FOREACH(int &i, d)
+        i *= 10;
+    BOOST_TEST_EQ(10, numbers[0]);
+    BOOST_TEST_EQ(50, numbers[4]);
+    BOOST_TEST_EQ(6, numbers[6]);
+
+    // const collections use the const begin()
+    delimited const &cd = d;
+    int sum = 0;
+    BOOST_FOREACH(int const &i, cd)
+        sum += i;
+    BOOST_TEST_EQ(150, sum);
+
+    // rvalue collections
+    sum = 0;
+    BOOST_FOREACH(int i, get_delimited())
+        sum += i;
+    BOOST_TEST_EQ(150, sum);
+
+    // break and continue
+    sum = 0;
+    BOOST_FOREACH(int i, d)
+    {
+        if(20 == i)
+            continue;
+        if(40 == i)
+            break;
+        sum += i;
+    }
+    BOOST_TEST_EQ(40, sum);
+
+    // predeclared loop variables keep the last element
+    int last = 0;
+    BOOST_FOREACH(last, d)
+    {
+    }
+    BOOST_TEST_EQ(50, last);
+
+    // length-prefixed buffers, which may hold 0s
+    char const buf[] = "\4ab\0cd";
+    std::string s;
+    BOOST_FOREACH(char ch, counted(buf))
+        s += ch ? ch : '.';
+    BOOST_TEST_EQ(std::string("ab.c"), s);
+
+    // empty collections
+    int none[] = {0};
+    BOOST_FOREACH(int i, delimited(none))
+    {
+        (void)i;
+        BOOST_TEST(false);
+    }
+    BOOST_FOREACH(char ch, counted("\0"))
+    {
+        (void)ch;
+        BOOST_TEST(false);
+    }
+
+    // an end() of another iterator type is not a sentinel
+    int elems[] = {1, 2, 3, 4};
+    std::vector<int> order;
+    BOOST_FOREACH(int i, tail(elems + 1, elems + 4))
+        order.push_back(i);
+    BOOST_REVERSE_FOREACH(int i, tail(elems + 1, elems + 4))
+        order.push_back(i);
+    BOOST_TEST_EQ(6u, order.size());
+    BOOST_TEST_EQ(2, order.front());
+    BOOST_TEST_EQ(2, order.back());
+    BOOST_TEST_EQ(4, order[2]);
+    BOOST_TEST_EQ(4, order[3]);
+
+#if defined(__cpp_lib_ranges)
+    // C++20 ranges with sentinel_for end types
+    std::vector<int> v;
+    for(int i = 0; i != 10; ++i)
+        v.push_back(i);
+    auto small = std::views::take_while(v, [](int i) { return i < 4; });
+    BOOST_MPL_ASSERT((boost::foreach::has_sentinel<decltype(small)>));
+    sum = 0;
+    BOOST_FOREACH(int i, small)
+        sum += i;
+    BOOST_TEST_EQ(6, sum);
+
+    sum = 0;
+    BOOST_FOREACH(int &i, std::ranges::subrange(std::counted_iterator(v.begin() + 5, 3), std::default_sentinel))
+        sum += i;
+    BOOST_TEST_EQ(18, sum);
+#endif
+
+    return boost::report_errors();
+}
+
+#endif
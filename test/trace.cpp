@@ -0,0 +1,147 @@
+//  trace.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   17 October 2026 : Initial version.
+*/
+
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_NO_CXX11_LAMBDAS) || defined(BOOST_NO_CXX11_HDR_MUTEX)                       \
+ || defined(BOOST_NO_CXX11_HDR_ATOMIC) || defined(BOOST_NO_CXX11_HDR_CHRONO)                    \
+ || defined(BOOST_NO_CXX11_HDR_THREAD) || defined(BOOST_NO_CXX11_THREAD_LOCAL)                  \
+ || defined(BOOST_NO_CXX11_RVALUE_REFERENCES) || defined(BOOST_NO_CXX11_SMART_PTR)              \
+ || defined(BOOST_NO_EXCEPTIONS)
+
+int main()
+{
+    return boost::report_errors();
+}
+
+#else
+
+#define BOOST_FOREACH_TRACE
+#define BOOST_FOREACH_TRACE_CAPACITY 64
+
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sstream>
+#include <boost/foreach.hpp>
+
+namespace trace = boost::foreach::trace;
+
+///////////////////////////////////////////////////////////////////////////////
+// count
+//   The occurrences of what in str.
+std::size_t count(std::string const &str, std::string const &what)
+{
+    std::size_t n = 0;
+    for(std::size_t pos = str.find(what); std::string::npos != pos; pos = str.find(what, pos + 1))
+        ++n;
+    return n;
+}
+
+int const sum_line = __LINE__ + 6;
+
+template<typename Collection>
+int sum(Collection const &col)
+{
+    int result = 0;
+    BOOST_FOREACH(int i, col)
+        result += i;
+    return result;
+}
+
+std::string site(int line)
+{
+    std::ostringstream sout;
+    sout << "\"name\":\"" << __FILE__ << ':' << line << '"';
+    return sout.str();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    std::vector<int> v(5, 1);
+    std::list<int> const l(3, 1);
+    int total = 0;
+
+    // each loop is a complete event, with its site, type and trip count
+    total += sum(v);
+    total += sum(l);
+    int const reverse_line = __LINE__ + 1;
+    BOOST_REVERSE_FOREACH(int i, v)
+        total += i;
+    std::ostringstream json;
+    BOOST_TEST_EQ(3u, trace::flush(json));
+    std::string out = json.str();
+    BOOST_TEST_EQ(0u, out.find("{\"traceEvents\":["));
+    BOOST_TEST_EQ(3u, count(out, "\"ph\":\"X\""));
+    BOOST_TEST_EQ(2u, count(out, site(sum_line)));
+    BOOST_TEST_EQ(1u, count(out, site(reverse_line)));
+    BOOST_TEST_EQ(2u, count(out, "\"trips\":5}"));
+    BOOST_TEST_EQ(1u, count(out, "\"trips\":3}"));
+    BOOST_TEST_EQ(1u, count(out, "list"));
+    BOOST_TEST(std::string::npos != out.find("],\"displayTimeUnit\":\"ns\"}"));
+
+    // the spans come out in the order the loops started, nested loops after
+    // the loops around them, and once only
+    int const outer_line = __LINE__ + 1;
+    BOOST_FOREACH(int i, v)
+        total += sum(l) * i;
+    json.str("");
+    BOOST_TEST_EQ(6u, trace::flush(json));
+    out = json.str();
+    BOOST_TEST(out.find(site(outer_line)) < out.find(site(sum_line)));
+    json.str("");
+    BOOST_TEST_EQ(0u, trace::flush(json));
+    BOOST_TEST_EQ(0u, count(json.str(), "\"ph\""));
+
+    // sampling records one in every so many loops; 0 none
+    BOOST_TEST_EQ(1u, trace::set_sampling(4));
+    for(int k = 0; k != 20; ++k)
+        total += sum(v);
+    json.str("");
+    BOOST_TEST_EQ(5u, trace::flush(json));
+    BOOST_TEST_EQ(4u, trace::set_sampling(0));
+    total += sum(v);
+    BOOST_TEST_EQ(0u, trace::flush(json));
+    trace::set_sampling(1);
+
+    // the threshold drops the short loops
+    BOOST_TEST(std::chrono::nanoseconds(0) == trace::set_threshold(std::chrono::hours(1)));
+    total += sum(v);
+    BOOST_TEST_EQ(0u, trace::flush(json));
+    trace::set_threshold(std::chrono::nanoseconds(0));
+
+    // a full ring buffer keeps the latest spans
+    for(int k = 0; k != 100; ++k)
+        total += sum(v);
+    BOOST_TEST_EQ(64u, trace::flush(json));
+
+    // the spans of threads that have exited are kept
+    std::thread worker([&v] {
+        for(int k = 0; k != 10; ++k)
+            sum(v);
+    });
+    worker.join();
+    total += sum(v);
+    json.str("");
+    BOOST_TEST_EQ(11u, trace::flush(json));
+    BOOST_TEST_EQ(11u, count(json.str(), site(sum_line)));
+
+    BOOST_TEST(total > 0);
+    return boost::report_errors();
+}
+
+#endif
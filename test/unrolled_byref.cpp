@@ -0,0 +1,93 @@
+//  unrolled_byref.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <list>
+#include <vector>
+#include <boost/array.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/foreach.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// define some containers
+//
+int my_array[5] = { 1,2,3,4,5 };
+int const (&my_const_array)[5] = my_array;
+
+// bigger than BOOST_FOREACH_UNROLL_THRESHOLD, so unrolled K times
+int big_array[40];
+
+///////////////////////////////////////////////////////////////////////////////
+// addresses_match
+//   references refer to the collection's own elements
+template<typename Range>
+bool addresses_match(Range &rng)
+{
+    bool match = true;
+    BOOST_DEDUCED_TYPENAME Range::iterator it = rng.begin();
+    BOOST_FOREACH_UNROLLED(BOOST_DEDUCED_TYPENAME Range::reference r, rng, 3)
+    {
+        match = match && &r == &*it;
+        ++it;
+    }
+    return match && it == rng.end();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    // const references
+    int const *p = my_array;
+    bool match = true;
+    BOOST_FOREACH_UNROLLED(int const &i, my_const_array, 4)
+        match = match && &i == p++;
+    BOOST_TEST(match);
+    BOOST_TEST(p == my_array + 5);
+
+    // mutate the mutable collections
+    BOOST_FOREACH_UNROLLED(int &i, my_array, 4)
+        ++i;
+    BOOST_TEST_EQ(2, my_array[0]);
+    BOOST_TEST_EQ(6, my_array[4]);
+
+    int n = 0;
+    BOOST_FOREACH_UNROLLED(int &i, big_array, 4)
+        i = n++;
+    BOOST_TEST_EQ(40, n);
+    BOOST_TEST_EQ(0, big_array[0]);
+    BOOST_TEST_EQ(39, big_array[39]);
+
+    boost::array<int, 7> ba = {{0, 0, 0, 0, 0, 0, 0}};
+    BOOST_FOREACH_UNROLLED(int &i, ba, 2)
+        i = 1;
+    int sum = 0;
+    BOOST_FOREACH(int i, ba)
+        sum += i;
+    BOOST_TEST_EQ(7, sum);
+
+    for(int size = 0; size != 10; ++size)
+    {
+        std::vector<int> v(size);
+        std::list<int> l(size);
+        BOOST_TEST(addresses_match(v));
+        BOOST_TEST(addresses_match(l));
+    }
+
+    // rvalues live as long as the loop
+    sum = 0;
+    BOOST_FOREACH_UNROLLED(int const &i, std::vector<int>(11, 2), 4)
+        sum += i;
+    BOOST_TEST_EQ(22, sum);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,150 @@
+//  unrolled_byval.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/array.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/foreach.hpp>
+#ifndef BOOST_NO_CXX11_HDR_ARRAY
+# include <array>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// define some containers
+//
+int my_array[5] = { 1,2,3,4,5 };
+int const (&my_const_array)[5] = my_array;
+
+// bigger than BOOST_FOREACH_UNROLL_THRESHOLD, so unrolled K times
+int big_array[40];
+
+///////////////////////////////////////////////////////////////////////////////
+// digits
+//   the elements visited, as digits
+template<typename Range>
+std::string digits1(Range const &rng)
+{
+    std::string s;
+    BOOST_FOREACH_UNROLLED(int i, rng, 1)
+        s += static_cast<char>('0' + i % 10);
+    return s;
+}
+
+template<typename Range>
+std::string digits3(Range const &rng)
+{
+    std::string s;
+    BOOST_FOREACH_UNROLLED(int i, rng, 3)
+        s += static_cast<char>('0' + i % 10);
+    return s;
+}
+
+template<typename Range>
+std::string digits4(Range const &rng)
+{
+    std::string s;
+    BOOST_FOREACH_UNROLLED(int i, rng, 4)
+        s += static_cast<char>('0' + i % 10);
+    return s;
+}
+
+template<typename Range>
+std::string expected(Range const &rng)
+{
+    std::string s;
+    BOOST_FOREACH(int i, rng)
+        s += static_cast<char>('0' + i % 10);
+    return s;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    for(int i = 0; i != 40; ++i)
+        big_array[i] = i;
+
+    // small arrays, unrolled completely
+    BOOST_TEST_EQ(std::string("12345"), digits1(my_array));
+    BOOST_TEST_EQ(std::string("12345"), digits4(my_const_array));
+
+    // bigger arrays, unrolled K times
+    BOOST_TEST_EQ(expected(big_array), digits1(big_array));
+    BOOST_TEST_EQ(expected(big_array), digits3(big_array));
+    BOOST_TEST_EQ(expected(big_array), digits4(big_array));
+
+    boost::array<int, 8> ba = {{1, 2, 3, 4, 5, 6, 7, 8}};
+    BOOST_TEST_EQ(std::string("12345678"), digits3(ba));
+#ifndef BOOST_NO_CXX11_HDR_ARRAY
+    std::array<int, 3> sa = {{7, 8, 9}};
+    BOOST_TEST_EQ(std::string("789"), digits4(sa));
+#endif
+
+    // collections of every length, whatever the remainder
+    for(int n = 0; n != 10; ++n)
+    {
+        std::vector<int> v;
+        for(int i = 0; i != n; ++i)
+            v.push_back(i);
+        std::list<int> l(v.begin(), v.end());
+        BOOST_TEST_EQ(expected(v), digits1(v));
+        BOOST_TEST_EQ(expected(v), digits3(v));
+        BOOST_TEST_EQ(expected(v), digits4(v));
+        BOOST_TEST_EQ(expected(l), digits3(l));
+    }
+
+    // break and continue, in both kinds of loop
+    std::string s;
+    BOOST_FOREACH_UNROLLED(int i, my_array, 2)
+    {
+        if(2 == i)
+            continue;
+        if(4 == i)
+            break;
+        s += static_cast<char>('0' + i);
+    }
+    BOOST_TEST_EQ(std::string("13"), s);
+
+    s.clear();
+    BOOST_FOREACH_UNROLLED(int i, big_array, 4)
+    {
+        if(0 != i % 3)
+            continue;
+        if(21 == i)
+            break;
+        s += static_cast<char>('0' + i % 10);
+    }
+    BOOST_TEST_EQ(std::string("0369258"), s);
+
+    // a predeclared variable keeps the last element
+    int last = 0;
+    BOOST_FOREACH_UNROLLED(last, big_array, 4)
+    {
+    }
+    BOOST_TEST_EQ(39, last);
+
+    BOOST_FOREACH_UNROLLED(last, my_array, 4)
+    {
+    }
+    BOOST_TEST_EQ(5, last);
+
+    // null-terminated strings
+    s.clear();
+    BOOST_FOREACH_UNROLLED(char ch, static_cast<char const *>("hello"), 4)
+        s += ch;
+    BOOST_TEST_EQ(std::string("hello"), s);
+
+    return boost::report_errors();
+}
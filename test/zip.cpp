@@ -0,0 +1,120 @@
+//  zip.cpp
+///
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/*
+ Revision history:
+   16 October 2026 : Initial version.
+*/
+
+#include <list>
+#include <string>
+#include <vector>
+#include <utility>
+#include <boost/array.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/foreach.hpp>
+
+int calls = 0;
+
+std::vector<int> get_vector()
+{
+    ++calls;
+    std::vector<int> v;
+    for(int i = 0; i != 5; ++i)
+        v.push_back(i);
+    return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// pairs
+//   the pairs of elements visited, as digits and letters
+template<typename Digits, typename Letters>
+std::string pairs(Digits const &digits, Letters const &letters)
+{
+    std::string s;
+    BOOST_FOREACH_ZIP((int i, digits)(char ch, letters))
+    {
+        s += static_cast<char>('0' + i);
+        s += ch;
+    }
+    return s;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_main
+//
+int main()
+{
+    std::vector<int> v = get_vector();
+    std::list<int> l(v.begin(), v.end());
+    std::string letters("abc");
+    std::list<char> letter_list(letters.begin(), letters.end());
+
+    // random-access, mixed and node-based collections stop at the shortest
+    BOOST_TEST_EQ(std::string("0a1b2c"), pairs(v, letters));
+    BOOST_TEST_EQ(std::string("0a1b2c"), pairs(l, letters));
+    BOOST_TEST_EQ(std::string("0a1b2c"), pairs(v, letter_list));
+    BOOST_TEST_EQ(std::string("0a1b2c"), pairs(l, letter_list));
+    BOOST_TEST_EQ(std::string(""), pairs(std::vector<int>(), letters));
+    BOOST_TEST_EQ(std::string(""), pairs(l, std::list<char>()));
+
+    // arrays and null-terminated strings
+    int arr[4] = {1, 2, 3, 4};
+    BOOST_TEST_EQ(std::string("1x2y3z"), pairs(arr, static_cast<char const *>("xyz")));
+
+    // three collections, writing through a reference
+    std::vector<double> prices(4, 1.5);
+    boost::array<int, 5> sizes = {{2, 4, 6, 8, 10}};
+    std::vector<double> notional(3, 0.);
+    BOOST_FOREACH_ZIP((double price, prices)(int size, sizes)(double &n, notional))
+        n = price * size;
+    BOOST_TEST_EQ(3., notional[0]);
+    BOOST_TEST_EQ(9., notional[2]);
+
+    // rvalues are evaluated once, and live as long as the loop
+    int sum = 0;
+    BOOST_FOREACH_ZIP((int i, get_vector())(int const &j, l)(int k, get_vector()))
+        sum += i * j + k;
+    BOOST_TEST_EQ(2, calls - 1);
+    BOOST_TEST_EQ(30 + 10, sum);
+
+    // a single collection, and proxies
+    std::vector<bool> bits(3, true);
+    sum = 0;
+    BOOST_FOREACH_ZIP((bool b, bits))
+        sum += b;
+    BOOST_TEST_EQ(3, sum);
+
+    // break and continue
+    std::string s;
+    BOOST_FOREACH_ZIP((int i, l)(char ch, letters + "de"))
+    {
+        if(1 == i)
+            continue;
+        if(3 == i)
+            break;
+        s += ch;
+    }
+    BOOST_TEST_EQ(std::string("ac"), s);
+
+    // predeclared variables keep the last elements
+    int last_int = 0;
+    char last_char = 0;
+    BOOST_FOREACH_ZIP((last_int, v)(last_char, letter_list))
+    {
+    }
+    BOOST_TEST_EQ(2, last_int);
+    BOOST_TEST_EQ('c', last_char);
+
+    // pairs of iterators
+    sum = 0;
+    BOOST_FOREACH_ZIP((int i, std::make_pair(v.begin() + 1, v.end()))(int j, std::make_pair(l.begin(), l.end())))
+        sum += i - j;
+    BOOST_TEST_EQ(4, sum);
+
+    return boost::report_errors();
+}